@@ -43,10 +43,11 @@ struct pointer_traits<alloc_id>
         typedef alloc_id other;
     };
 
-    // implemented for the purposes of alignment test in disjoint pool's do_deallocate
+    // implemented for the purposes of alignment test in disjoint pool's do_deallocate,
+    // and of ordering blocks by address in trim; every allocation gets 16MiB of addresses
     static void * get(const alloc_id & id)
     {
-        return reinterpret_cast<void *>(id.alignment);
+        return reinterpret_cast<void *>((id.id << 24) + id.offset);
     }
 };
 
@@ -75,6 +76,7 @@ public:
         ret.id = id_to_allocate;
         ret.size = bytes;
         ret.alignment = alignment;
+        ret.offset = 0;
 
         id_to_allocate = 0;
 
@@ -274,6 +276,162 @@ void TestDisjointSynchronizedPoolCachingOversized()
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 #endif
 
+template<template<typename, typename> class PoolTemplate>
+void TestDisjointPoolTrim()
+{
+    dummy_resource upstream;
+    thrust::mr::new_delete_resource bookkeeper;
+
+    typedef PoolTemplate<
+        dummy_resource,
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+
+    Pool pool(&upstream, &bookkeeper, opts);
+
+    // fill the first chunk of four blocks, and take one block from the second one
+    alloc_id blocks[5];
+    upstream.id_to_allocate = 1;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(blocks[i].id, 1u);
+    }
+
+    upstream.id_to_allocate = 2;
+    blocks[4] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(blocks[4].id, 2u);
+
+    upstream.id_to_allocate = 3;
+    alloc_id oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    ASSERT_EQUAL(oversized.id, 3u);
+    pool.do_deallocate(oversized, 32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    // trimming returns the chunk with no blocks in use, and then the cached block
+    upstream.id_to_deallocate = 1;
+    pool.trim();
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    upstream.id_to_allocate = 4;
+    oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    ASSERT_EQUAL(oversized.id, 4u);
+
+    // the free blocks of the chunk still in use remain in the pool
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        alloc_id a = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(a.id, 2u);
+    }
+
+    upstream.id_to_allocate = 5;
+    alloc_id a = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a.id, 5u);
+}
+
+void TestDisjointUnsynchronizedPoolTrim()
+{
+    TestDisjointPoolTrim<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolTrim);
+
+#if THRUST_CPP_DIALECT >= 2011
+void TestDisjointSynchronizedPoolTrim()
+{
+    TestDisjointPoolTrim<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolTrim);
+#endif
+
+void TestDisjointPoolStatistics()
+{
+    dummy_resource upstream;
+    thrust::mr::new_delete_resource bookkeeper;
+
+    typedef thrust::mr::basic_disjoint_unsynchronized_pool_resource<
+        dummy_resource,
+        thrust::mr::new_delete_resource,
+        thrust::mr::pool_statistics
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.smallest_block_size = 16;
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+
+    Pool pool(&upstream, &bookkeeper, opts);
+
+    thrust::mr::pool_statistics_snapshot stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets.size(), 17u);
+    ASSERT_EQUAL(stats.buckets[0].block_size, 16u);
+    ASSERT_EQUAL(stats.upstream_allocations, 0u);
+
+    // fill the first chunk of four blocks, and take one block from the second one, of six blocks
+    alloc_id blocks[5];
+    upstream.id_to_allocate = 1;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    upstream.id_to_allocate = 2;
+    blocks[4] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // allocate an overaligned block from upstream, and then from the cache
+    upstream.id_to_allocate = 3;
+    alloc_id oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    pool.do_deallocate(oversized, 32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    pool.do_deallocate(oversized, 32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets[0].allocations, 5u);
+    ASSERT_EQUAL(stats.buckets[0].deallocations, 4u);
+    ASSERT_EQUAL(stats.buckets[0].free_blocks, 9u);
+    ASSERT_EQUAL(stats.chunks, 2u);
+    ASSERT_EQUAL(stats.upstream_allocations, 3u);
+    ASSERT_EQUAL(stats.upstream_bytes, 4 * 16u + 6 * 16u + 32u);
+    ASSERT_EQUAL(stats.peak_upstream_bytes, 4 * 16u + 6 * 16u + 32u);
+    ASSERT_EQUAL(stats.bytes_in_use, 16u);
+    ASSERT_EQUAL(stats.peak_bytes_in_use, 5 * 16u + 32u);
+    ASSERT_EQUAL(stats.oversized_cache_hits, 1u);
+    ASSERT_EQUAL(stats.oversized_cache_misses, 1u);
+
+    // trimming returns the chunk with no blocks in use, and the cached block
+    pool.trim();
+
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets[0].free_blocks, 5u);
+    ASSERT_EQUAL(stats.chunks, 1u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+    ASSERT_EQUAL(stats.upstream_bytes, 6 * 16u);
+    ASSERT_EQUAL(stats.peak_upstream_bytes, 4 * 16u + 6 * 16u + 32u);
+
+    pool.do_deallocate(blocks[4], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.release();
+
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets[0].free_blocks, 0u);
+    ASSERT_EQUAL(stats.chunks, 0u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 3u);
+    ASSERT_EQUAL(stats.upstream_bytes, 0u);
+    ASSERT_EQUAL(stats.bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestDisjointPoolStatistics);
+
 template<template<typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
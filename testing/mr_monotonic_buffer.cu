@@ -0,0 +1,170 @@
+#include <unittest/unittest.h>
+
+#include <thrust/mr/monotonic_buffer.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/new.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+    counting_resource() : allocations(0), deallocations(0), bytes_in_use(0)
+    {
+    }
+
+    ~counting_resource()
+    {
+        ASSERT_EQUAL(bytes_in_use, 0u);
+    }
+
+    virtual void * do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        ++allocations;
+        bytes_in_use += n;
+        return upstream.do_allocate(n, alignment);
+    }
+
+    virtual void do_deallocate(void * p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        ++deallocations;
+        bytes_in_use -= n;
+        upstream.do_deallocate(p, n, alignment);
+    }
+
+    std::size_t allocations;
+    std::size_t deallocations;
+    std::size_t bytes_in_use;
+
+private:
+    thrust::mr::new_delete_resource upstream;
+};
+
+void TestMonotonicBufferProvidedBuffer()
+{
+    counting_resource upstream;
+
+    alignas(64) char buffer[256];
+    thrust::mr::monotonic_buffer_resource<counting_resource> resource(&upstream, buffer, sizeof(buffer));
+
+    // allocations are made from the buffer, one after another, aligned as requested
+    void * a = resource.do_allocate(8, 8);
+    void * b = resource.do_allocate(16, 16);
+    void * c = resource.do_allocate(1, 1);
+    void * d = resource.do_allocate(32, 64);
+    ASSERT_EQUAL(a, static_cast<void *>(buffer));
+    ASSERT_EQUAL(b, static_cast<void *>(buffer + 16));
+    ASSERT_EQUAL(c, static_cast<void *>(buffer + 32));
+    ASSERT_EQUAL(d, static_cast<void *>(buffer + 64));
+    ASSERT_EQUAL(upstream.allocations, 0u);
+
+    // deallocation doesn't make the memory available again
+    resource.do_deallocate(d, 32, 64);
+    void * e = resource.do_allocate(128, 8);
+    ASSERT_EQUAL(e, static_cast<void *>(buffer + 96));
+    ASSERT_EQUAL(upstream.allocations, 0u);
+
+    // the rest of the buffer is too small, so a buffer is allocated from upstream
+    void * f = resource.do_allocate(64, 8);
+    ASSERT_EQUAL(upstream.allocations, 1u);
+    ASSERT_EQUAL(f < static_cast<void *>(buffer) || f >= static_cast<void *>(buffer + sizeof(buffer)), true);
+
+    // release returns the upstream buffer, and allocations start over from the provided buffer
+    resource.release();
+    ASSERT_EQUAL(upstream.deallocations, 1u);
+    ASSERT_EQUAL(upstream.bytes_in_use, 0u);
+
+    a = resource.do_allocate(8, 8);
+    ASSERT_EQUAL(a, static_cast<void *>(buffer));
+    ASSERT_EQUAL(upstream.allocations, 1u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferProvidedBuffer);
+
+void TestMonotonicBufferGrowth()
+{
+    counting_resource upstream;
+
+    {
+        thrust::mr::monotonic_buffer_resource<counting_resource> resource(&upstream, 256);
+
+        // nothing is allocated from upstream until the first allocation
+        ASSERT_EQUAL(upstream.allocations, 0u);
+
+        char * a = static_cast<char *>(resource.do_allocate(100, 4));
+        char * b = static_cast<char *>(resource.do_allocate(100, 4));
+        ASSERT_EQUAL(upstream.allocations, 1u);
+        ASSERT_EQUAL(b, a + 100);
+
+        // the next buffer is twice as large as the first one
+        char * c = static_cast<char *>(resource.do_allocate(100, 4));
+        ASSERT_EQUAL(upstream.allocations, 2u);
+        for (std::size_t i = 1; i < 5; ++i)
+        {
+            char * d = static_cast<char *>(resource.do_allocate(100, 4));
+            ASSERT_EQUAL(d, c + i * 100);
+        }
+        ASSERT_EQUAL(upstream.allocations, 2u);
+
+        // unless an allocation is larger than that
+        void * large = resource.do_allocate(10000, 256);
+        ASSERT_EQUAL(upstream.allocations, 3u);
+        ASSERT_EQUAL(reinterpret_cast<std::size_t>(large) % 256, 0u);
+
+        resource.release();
+        ASSERT_EQUAL(upstream.deallocations, 3u);
+
+        // after a release, buffers grow from the initial size again
+        a = static_cast<char *>(resource.do_allocate(300, 4));
+        ASSERT_EQUAL(upstream.allocations, 4u);
+        b = static_cast<char *>(resource.do_allocate(200, 4));
+        ASSERT_EQUAL(upstream.allocations, 5u);
+        ASSERT_EQUAL(b != a + 300, true);
+    }
+
+    // the destructor releases the remaining buffers
+    ASSERT_EQUAL(upstream.deallocations, 5u);
+    ASSERT_EQUAL(upstream.bytes_in_use, 0u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferGrowth);
+
+struct greater_by_remainder
+{
+    __host__ __device__
+    bool operator()(int x, int y) const
+    {
+        return x % 7 > y % 7;
+    }
+};
+
+void TestMonotonicBufferTemporaryAllocations()
+{
+    counting_resource upstream;
+
+    typedef thrust::mr::monotonic_buffer_resource<counting_resource> Resource;
+    Resource resource(&upstream, static_cast<std::size_t>(1) << 20);
+    thrust::mr::allocator<int, Resource> alloc(&resource);
+
+    thrust::host_vector<int> keys(10000);
+    thrust::host_vector<int> values(10000);
+    thrust::sequence(keys.begin(), keys.end());
+    thrust::sequence(values.begin(), values.end());
+
+    // the temporary storage of both sorts comes from a single upstream buffer
+    thrust::stable_sort_by_key(thrust::cpp::par(alloc), keys.begin(), keys.end(), values.begin(), greater_by_remainder());
+    ASSERT_EQUAL(keys[0], 6);
+    ASSERT_EQUAL(keys[9999], 9996);
+    thrust::stable_sort_by_key(thrust::cpp::par(alloc), keys.begin(), keys.end(), values.begin(), thrust::less<int>());
+    ASSERT_EQUAL(upstream.allocations, 1u);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        ASSERT_EQUAL(keys[i], i);
+        ASSERT_EQUAL(values[i], i);
+    }
+
+    resource.release();
+    ASSERT_EQUAL(upstream.deallocations, 1u);
+}
+DECLARE_UNITTEST(TestMonotonicBufferTemporaryAllocations);
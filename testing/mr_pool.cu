@@ -6,6 +6,12 @@
 
 #if THRUST_CPP_DIALECT >= 2011
 #include <thrust/mr/sync_pool.h>
+#include <thrust/mr/concurrent_pool.h>
+#include <thrust/mr/tls_pool.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
 #endif
 
 template<typename T>
@@ -249,6 +255,12 @@ void TestSynchronizedPool()
     TestPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
+
+void TestConcurrentPool()
+{
+    TestPool<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPool);
 #endif
 
 template<template<typename> class PoolTemplate>
@@ -332,8 +344,340 @@ void TestSynchronizedPoolCachingOversized()
     TestPoolCachingOversized<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
+
+void TestConcurrentPoolCachingOversized()
+{
+    TestPoolCachingOversized<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPoolCachingOversized);
+#endif
+
+template<template<typename> class PoolTemplate>
+void TestPoolCachingOversizedBestFit()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef PoolTemplate<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = true;
+    opts.largest_block_size = 1024;
+
+    Pool pool(&upstream, opts);
+
+    // blocks of 40 different sizes, eight per power of two
+    const std::size_t num_blocks = 40;
+    std::size_t sizes[num_blocks];
+    tracked_pointer<void> blocks[num_blocks];
+
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        sizes[i] = (static_cast<std::size_t>(2048) << (i / 8)) / 8 * (8 + i % 8);
+
+        upstream.id_to_allocate = i + 1;
+        blocks[i] = pool.do_allocate(sizes[i], 32);
+        ASSERT_EQUAL(blocks[i].id, i + 1);
+    }
+
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        pool.do_deallocate(blocks[i], sizes[i], 32);
+    }
+
+    // make sure every request is served by the smallest cached block it fits in,
+    // whatever order the blocks were cached in
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        blocks[i] = pool.do_allocate(sizes[i] - 1, 32);
+        ASSERT_EQUAL(blocks[i].id, i + 1);
+    }
+
+    // make sure that blocks are found when deallocated with the size they were last allocated with
+    for (std::size_t i = 0; i < num_blocks; ++i)
+    {
+        pool.do_deallocate(blocks[i], sizes[i] - 1, 32);
+    }
+
+    for (std::size_t i = num_blocks; i-- > 0; )
+    {
+        blocks[i] = pool.do_allocate(sizes[i], 32);
+        ASSERT_EQUAL(blocks[i].id, i + 1);
+    }
+
+    // nothing fitting is cached anymore
+    upstream.id_to_allocate = num_blocks + 1;
+    tracked_pointer<void> a = pool.do_allocate(sizes[0], 32);
+    ASSERT_EQUAL(a.id, num_blocks + 1);
+
+    // the destructor returns every block to upstream with the size it was allocated with
+}
+
+void TestUnsynchronizedPoolCachingOversizedBestFit()
+{
+    TestPoolCachingOversizedBestFit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedBestFit);
+
+#if THRUST_CPP_DIALECT >= 2011
+void TestSynchronizedPoolCachingOversizedBestFit()
+{
+    TestPoolCachingOversizedBestFit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedBestFit);
+
+void TestConcurrentPoolCachingOversizedBestFit()
+{
+    TestPoolCachingOversizedBestFit<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPoolCachingOversizedBestFit);
+#endif
+
+template<template<typename> class PoolTemplate>
+void TestPoolCachedBytesLimit()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef PoolTemplate<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.cache_oversized = true;
+    opts.largest_block_size = 1024;
+    opts.max_cached_bytes = 3 * 4096;
+
+    Pool pool(&upstream, opts);
+
+    tracked_pointer<void> blocks[4];
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        upstream.id_to_allocate = i + 1;
+        blocks[i] = pool.do_allocate(4096, 32);
+        ASSERT_EQUAL(blocks[i].id, i + 1);
+    }
+
+    // three blocks fit in the cache
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        pool.do_deallocate(blocks[i], 4096, 32);
+    }
+
+    // the fourth one pushes out the least recently cached block
+    upstream.id_to_deallocate = 1;
+    pool.do_deallocate(blocks[3], 4096, 32);
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    // and the most recently cached block is used first
+    tracked_pointer<void> a1 = pool.do_allocate(4096, 32);
+    ASSERT_EQUAL(a1.id, 4u);
+
+    tracked_pointer<void> a2 = pool.do_allocate(4096, 32);
+    ASSERT_EQUAL(a2.id, 3u);
+
+    // a block larger than the limit is not cached at all
+    upstream.id_to_allocate = 5;
+    tracked_pointer<void> a3 = pool.do_allocate(4 * 4096, 32);
+    ASSERT_EQUAL(a3.id, 5u);
+
+    pool.do_deallocate(a1, 4096, 32);
+    upstream.id_to_deallocate = 5;
+    pool.do_deallocate(a3, 4 * 4096, 32);
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    upstream.id_to_allocate = 6;
+    tracked_pointer<void> a4 = pool.do_allocate(4 * 4096, 32);
+    ASSERT_EQUAL(a4.id, 6u);
+
+    tracked_pointer<void> a5 = pool.do_allocate(4096, 32);
+    ASSERT_EQUAL(a5.id, 4u);
+}
+
+void TestUnsynchronizedPoolCachedBytesLimit()
+{
+    TestPoolCachedBytesLimit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachedBytesLimit);
+
+#if THRUST_CPP_DIALECT >= 2011
+void TestSynchronizedPoolCachedBytesLimit()
+{
+    TestPoolCachedBytesLimit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachedBytesLimit);
+
+void TestConcurrentPoolCachedBytesLimit()
+{
+    TestPoolCachedBytesLimit<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentPoolCachedBytesLimit);
+#endif
+
+template<template<typename> class PoolTemplate>
+void TestPoolTrim()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef PoolTemplate<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+
+    Pool pool(&upstream, opts);
+
+    // fill the first chunk of four blocks, and take one block from the second one
+    tracked_pointer<void> blocks[5];
+    upstream.id_to_allocate = 1;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(blocks[i].id, 1u);
+    }
+
+    upstream.id_to_allocate = 2;
+    blocks[4] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(blocks[4].id, 2u);
+
+    upstream.id_to_allocate = 3;
+    tracked_pointer<void> oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    ASSERT_EQUAL(oversized.id, 3u);
+    pool.do_deallocate(oversized, 32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    // trimming returns the chunk with no blocks in use, and then the cached block
+    upstream.id_to_deallocate = 1;
+    pool.trim();
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    upstream.id_to_allocate = 4;
+    oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    ASSERT_EQUAL(oversized.id, 4u);
+
+    // the free blocks of the chunk still in use remain in the pool
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        tracked_pointer<void> a = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(a.id, 2u);
+    }
+
+    upstream.id_to_allocate = 5;
+    tracked_pointer<void> a = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a.id, 5u);
+}
+
+void TestUnsynchronizedPoolTrim()
+{
+    TestPoolTrim<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolTrim);
+
+#if THRUST_CPP_DIALECT >= 2011
+void TestSynchronizedPoolTrim()
+{
+    TestPoolTrim<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolTrim);
 #endif
 
+void TestPoolStatistics()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef thrust::mr::basic_unsynchronized_pool_resource<
+        tracked_resource,
+        thrust::mr::pool_statistics
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.smallest_block_size = 16;
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+
+    Pool pool(&upstream, opts);
+
+    thrust::mr::pool_statistics_snapshot stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets.size(), 17u);
+    ASSERT_EQUAL(stats.buckets[0].block_size, 16u);
+    ASSERT_EQUAL(stats.buckets[16].block_size, 1u << 20);
+    ASSERT_EQUAL(stats.upstream_allocations, 0u);
+
+    // fill the first chunk of four blocks, and take one block from the second one
+    tracked_pointer<void> blocks[5];
+    upstream.id_to_allocate = 1;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    upstream.id_to_allocate = 2;
+    blocks[4] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+
+    // allocate an overaligned block from upstream, and then from the cache
+    upstream.id_to_allocate = 3;
+    tracked_pointer<void> oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    pool.do_deallocate(oversized, 32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    oversized = pool.do_allocate(32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+    pool.do_deallocate(oversized, 32, THRUST_MR_DEFAULT_ALIGNMENT * 2);
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets[0].allocations, 5u);
+    ASSERT_EQUAL(stats.buckets[0].deallocations, 4u);
+    ASSERT_EQUAL(stats.buckets[0].free_blocks, 7u);
+    ASSERT_EQUAL(stats.buckets[1].allocations, 0u);
+    ASSERT_EQUAL(stats.chunks, 2u);
+    ASSERT_EQUAL(stats.upstream_allocations, 3u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 0u);
+    ASSERT_EQUAL(stats.upstream_bytes, stats.peak_upstream_bytes);
+    ASSERT_EQUAL(stats.bytes_in_use, 16u);
+    ASSERT_EQUAL(stats.peak_bytes_in_use, 5 * 16u + 32u);
+    ASSERT_EQUAL(stats.oversized_cache_hits, 1u);
+    ASSERT_EQUAL(stats.oversized_cache_misses, 1u);
+
+    // trimming returns the chunk with no blocks in use, and the cached block
+    std::size_t peak_upstream_bytes = stats.peak_upstream_bytes;
+    pool.trim();
+
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets[0].free_blocks, 3u);
+    ASSERT_EQUAL(stats.chunks, 1u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+    ASSERT_LESS(stats.upstream_bytes, peak_upstream_bytes);
+    ASSERT_EQUAL(stats.peak_upstream_bytes, peak_upstream_bytes);
+
+    pool.do_deallocate(blocks[4], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    pool.release();
+
+    stats = pool.statistics();
+    ASSERT_EQUAL(stats.buckets[0].free_blocks, 0u);
+    ASSERT_EQUAL(stats.chunks, 0u);
+    ASSERT_EQUAL(stats.upstream_deallocations, 3u);
+    ASSERT_EQUAL(stats.upstream_bytes, 0u);
+    ASSERT_EQUAL(stats.bytes_in_use, 0u);
+    ASSERT_EQUAL(stats.peak_bytes_in_use, 5 * 16u + 32u);
+}
+DECLARE_UNITTEST(TestPoolStatistics);
+
 template<template<typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -356,5 +700,235 @@ void TestSynchronizedGlobalPool()
     TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestConcurrentGlobalPool()
+{
+    TestGlobalPool<thrust::mr::concurrent_pool_resource>();
+}
+DECLARE_UNITTEST(TestConcurrentGlobalPool);
 #endif
 
+#if THRUST_CPP_DIALECT >= 2011
+void TestConcurrentPoolMagazines()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef thrust::mr::concurrent_pool_resource<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+    opts.magazine_size = 4;
+
+    Pool pool(&upstream, opts);
+
+    // the magazine is refilled with two blocks at a time, so the
+    // first chunk, of four blocks, serves the first two refills
+    upstream.id_to_allocate = 1;
+    tracked_pointer<void> blocks[8];
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(blocks[i].id, 1u);
+    }
+
+    upstream.id_to_allocate = 2;
+    for (std::size_t i = 4; i < 8; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(blocks[i].id, 2u);
+    }
+
+    // a full magazine returns its older half to the shared pool, and the most
+    // recently freed block is reused first
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    tracked_pointer<void> a1 = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a1.id, blocks[7].id);
+    ASSERT_EQUAL(a1.offset, blocks[7].offset);
+
+    // and the other blocks come back from the magazine and the shared pool, not from upstream
+    for (std::size_t i = 0; i < 7; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+}
+DECLARE_UNITTEST(TestConcurrentPoolMagazines);
+
+void TestConcurrentPoolThreads()
+{
+    typedef thrust::mr::concurrent_pool_resource<
+        thrust::mr::new_delete_resource
+    > Pool;
+
+    thrust::mr::new_delete_resource upstream;
+    Pool pool(&upstream);
+
+    const std::size_t num_threads = 8;
+    const std::size_t num_blocks = 256;
+
+    std::vector<int> failures(num_threads, 0);
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            std::vector<void *> blocks(num_blocks);
+            std::vector<std::size_t> sizes(num_blocks);
+
+            for (std::size_t round = 0; round < 16; ++round)
+            {
+                for (std::size_t i = 0; i < num_blocks; ++i)
+                {
+                    sizes[i] = 1 + (i * 37 + t * 11 + round) % 4000;
+                    blocks[i] = pool.do_allocate(sizes[i]);
+                    std::memset(blocks[i], static_cast<int>(t), sizes[i]);
+                }
+
+                // no block was handed out to two threads at once
+                for (std::size_t i = 0; i < num_blocks; ++i)
+                {
+                    unsigned char * bytes = static_cast<unsigned char *>(blocks[i]);
+                    for (std::size_t j = 0; j < sizes[i]; ++j)
+                    {
+                        if (bytes[j] != t)
+                        {
+                            ++failures[t];
+                            break;
+                        }
+                    }
+                }
+
+                // and return them, for the next round to reuse
+                for (std::size_t i = 0; i < num_blocks; ++i)
+                {
+                    pool.do_deallocate(blocks[i], sizes[i]);
+                }
+            }
+        });
+    }
+
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+        threads[t].join();
+        ASSERT_EQUAL(failures[t], 0);
+    }
+}
+DECLARE_UNITTEST(TestConcurrentPoolThreads);
+
+void TestTlsPoolRemoteFree()
+{
+    thrust::mr::new_delete_resource upstream;
+
+    thrust::mr::tls_pool_resource<
+        thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource>
+    > & pool = thrust::mr::tls_pool_with_remote_frees(&upstream);
+
+    void * a1 = pool.do_allocate(16);
+
+    // a block deallocated by another thread is returned to the pool of the thread that allocated it
+    std::thread([&]{ pool.do_deallocate(a1, 16); }).join();
+
+    void * a2 = pool.do_allocate(16);
+    ASSERT_EQUAL(a1, a2);
+
+    pool.do_deallocate(a2, 16);
+}
+DECLARE_UNITTEST(TestTlsPoolRemoteFree);
+
+void TestTlsPoolTrimRemoteFrees()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef thrust::mr::unsynchronized_pool_resource<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+
+    thrust::mr::tls_pool_resource<Pool> pool(&upstream, opts);
+
+    // one chunk of four blocks
+    upstream.id_to_allocate = 1;
+    tracked_pointer<void> blocks[4];
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(blocks[i].id, 1u);
+    }
+
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    std::thread([&]{ pool.do_deallocate(blocks[3], 16, THRUST_MR_DEFAULT_ALIGNMENT); }).join();
+
+    // trim reclaims the block freed by the other thread, without the owning thread allocating again,
+    // so the whole chunk goes back upstream
+    upstream.id_to_deallocate = 1;
+    pool.trim();
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+}
+DECLARE_UNITTEST(TestTlsPoolTrimRemoteFrees);
+
+void TestTlsPoolTrimThreshold()
+{
+    tracked_resource upstream;
+
+    upstream.id_to_allocate = -1u;
+
+    typedef thrust::mr::unsynchronized_pool_resource<
+        tracked_resource
+    > Pool;
+
+    thrust::mr::pool_options opts = Pool::get_default_options();
+    opts.min_blocks_per_chunk = 4;
+    opts.min_bytes_per_chunk = 64;
+
+    thrust::mr::tls_pool_resource<Pool> pool(&upstream, opts);
+    pool.set_trim_threshold(48);
+
+    // two chunks of four blocks
+    tracked_pointer<void> blocks[8];
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        if (i % 4 == 0)
+        {
+            upstream.id_to_allocate = i / 4 + 1;
+        }
+        blocks[i] = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+        ASSERT_EQUAL(blocks[i].id, i / 4 + 1);
+    }
+
+    // the pool is trimmed once the bytes in use drop more than 48 bytes below their peak,
+    // which is when the last block of the first chunk is returned, by another thread
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        pool.do_deallocate(blocks[i], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    }
+
+    std::thread([&]{ pool.do_deallocate(blocks[3], 16, THRUST_MR_DEFAULT_ALIGNMENT); }).join();
+
+    upstream.id_to_deallocate = 1;
+    pool.do_deallocate(blocks[4], 16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+    // the freed block of the second chunk is still in the pool
+    tracked_pointer<void> a = pool.do_allocate(16, THRUST_MR_DEFAULT_ALIGNMENT);
+    ASSERT_EQUAL(a.id, 2u);
+}
+DECLARE_UNITTEST(TestTlsPoolTrimThreshold);
+#endif
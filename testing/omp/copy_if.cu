@@ -0,0 +1,211 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/partition.h>
+#include <thrust/remove.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <vector>
+
+struct is_flagged
+{
+  const int *flags;
+
+  __host__ __device__
+  bool operator()(long long x) const
+  {
+    return flags[x] != 0;
+  }
+};
+
+struct is_multiple_of
+{
+  long long d;
+
+  __host__ __device__
+  bool operator()(long long x) const
+  {
+    return x % d == 0;
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// nothing, everything, a single element, every other element, the front half,
+// and a block straddling the middle
+std::vector<thrust::host_vector<int> > make_flag_patterns(int n)
+{
+  std::vector<thrust::host_vector<int> > patterns(3, thrust::host_vector<int>(n, 0));
+  patterns[1] = thrust::host_vector<int>(n, 1);
+  patterns[2][n / 2] = 1;
+
+  thrust::host_vector<int> flags(n, 0);
+  for(int i = 0; i < n; i += 2) flags[i] = 1;
+  patterns.push_back(flags);
+
+  flags = thrust::host_vector<int>(n, 0);
+  for(int i = 0; i < n / 2; ++i) flags[i] = 1;
+  patterns.push_back(flags);
+
+  flags = thrust::host_vector<int>(n, 0);
+  for(int i = n / 3; i < 2 * n / 3; ++i) flags[i] = 1;
+  patterns.push_back(flags);
+
+  return patterns;
+}
+
+
+// selects the flagged elements of [0, n) with every algorithm, with and without
+// a stencil, and compares the results with thrust::seq
+void check_copy_if(const thrust::host_vector<int> &flags)
+{
+  const int n = static_cast<int>(flags.size());
+
+  thrust::host_vector<long long> input(thrust::make_counting_iterator(0), thrust::make_counting_iterator(n));
+
+  is_flagged pred = {thrust::raw_pointer_cast(flags.data())};
+
+  thrust::host_vector<long long> ref(n), omp(n), ref_false(n), omp_false(n);
+
+  auto ref_end = thrust::copy_if(thrust::seq, input.begin(), input.end(), ref.begin(), pred);
+  auto omp_end = thrust::copy_if(thrust::omp::par, input.begin(), input.end(), omp.begin(), pred);
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::copy_if(thrust::seq, input.begin(), input.end(), flags.begin(), ref.begin(), thrust::identity<int>());
+  omp_end = thrust::copy_if(thrust::omp::par, input.begin(), input.end(), flags.begin(), omp.begin(), thrust::identity<int>());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::remove_copy_if(thrust::seq, input.begin(), input.end(), ref.begin(), pred);
+  omp_end = thrust::remove_copy_if(thrust::omp::par, input.begin(), input.end(), omp.begin(), pred);
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::remove_copy_if(thrust::seq, input.begin(), input.end(), flags.begin(), ref.begin(), thrust::identity<int>());
+  omp_end = thrust::remove_copy_if(thrust::omp::par, input.begin(), input.end(), flags.begin(), omp.begin(), thrust::identity<int>());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  auto ref_ends = thrust::stable_partition_copy(thrust::seq, input.begin(), input.end(), ref.begin(), ref_false.begin(), pred);
+  auto omp_ends = thrust::stable_partition_copy(thrust::omp::par, input.begin(), input.end(), omp.begin(), omp_false.begin(), pred);
+  ASSERT_EQUAL(omp_ends.first - omp.begin(), ref_ends.first - ref.begin());
+  ASSERT_EQUAL(omp_ends.second - omp_false.begin(), ref_ends.second - ref_false.begin());
+  ASSERT_EQUAL(omp, ref);
+  ASSERT_EQUAL(omp_false, ref_false);
+
+  ref_ends = thrust::partition_copy(thrust::seq, input.begin(), input.end(), flags.begin(), ref.begin(), ref_false.begin(), thrust::identity<int>());
+  omp_ends = thrust::partition_copy(thrust::omp::par, input.begin(), input.end(), flags.begin(), omp.begin(), omp_false.begin(), thrust::identity<int>());
+  ASSERT_EQUAL(omp_ends.first - omp.begin(), ref_ends.first - ref.begin());
+  ASSERT_EQUAL(omp_ends.second - omp_false.begin(), ref_ends.second - ref_false.begin());
+  ASSERT_EQUAL(omp, ref);
+  ASSERT_EQUAL(omp_false, ref_false);
+}
+
+
+void TestOmpCopyIfPatterns(void)
+{
+  const int sizes[] = {4097, 10001, (1 << 16) + 3, 100003};
+
+  for(int n : sizes)
+  {
+    for(const thrust::host_vector<int> &flags : make_flag_patterns(n))
+    {
+      check_copy_if(flags);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpCopyIfPatterns);
+
+
+void TestOmpCopyIfCountingInput(void)
+{
+  const int n = 100003;
+
+  // input and stencil which can't be written, selecting every seventh element
+  auto input = thrust::make_counting_iterator<long long>(0);
+
+  thrust::host_vector<long long> ref(n), omp(n), ref_false(n), omp_false(n);
+
+  auto ref_end = thrust::copy_if(thrust::seq, input, input + n, ref.begin(), is_multiple_of{7});
+  auto omp_end = thrust::copy_if(thrust::omp::par, input, input + n, omp.begin(), is_multiple_of{7});
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::remove_copy_if(thrust::seq, input, input + n, input, ref.begin(), is_multiple_of{7});
+  omp_end = thrust::remove_copy_if(thrust::omp::par, input, input + n, input, omp.begin(), is_multiple_of{7});
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  auto ref_ends = thrust::stable_partition_copy(thrust::seq, input, input + n, input, ref.begin(), ref_false.begin(), is_multiple_of{7});
+  auto omp_ends = thrust::stable_partition_copy(thrust::omp::par, input, input + n, input, omp.begin(), omp_false.begin(), is_multiple_of{7});
+  ASSERT_EQUAL(omp_ends.first - omp.begin(), ref_ends.first - ref.begin());
+  ASSERT_EQUAL(omp_ends.second - omp_false.begin(), ref_ends.second - ref_false.begin());
+  ASSERT_EQUAL(omp, ref);
+  ASSERT_EQUAL(omp_false, ref_false);
+}
+DECLARE_UNITTEST(TestOmpCopyIfCountingInput);
+
+
+void TestOmpCopyIfToTransformAndDiscardOutput(void)
+{
+  const int n = 100003;
+
+  auto input = thrust::make_counting_iterator<long long>(0);
+
+  thrust::host_vector<long long> ref(n), omp(n), ref_false(n), omp_false(n);
+
+  // every output is written exactly once, so it is tripled exactly once
+  auto ref_end = thrust::copy_if(thrust::seq, input, input + n, ref.begin(), is_multiple_of{3});
+  thrust::copy_if(thrust::omp::par, input, input + n,
+                  thrust::make_transform_output_iterator(omp.begin(), times_three()), is_multiple_of{3});
+  const int num_selected = static_cast<int>(ref_end - ref.begin());
+  for(int i = 0; i < num_selected; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+
+  auto ref_ends = thrust::stable_partition_copy(thrust::seq, input, input + n, ref.begin(), ref_false.begin(), is_multiple_of{3});
+  thrust::stable_partition_copy(thrust::omp::par, input, input + n,
+                                thrust::make_transform_output_iterator(omp.begin(), times_three()),
+                                thrust::make_transform_output_iterator(omp_false.begin(), times_three()),
+                                is_multiple_of{3});
+  const int num_false = static_cast<int>(ref_ends.second - ref_false.begin());
+  for(int i = 0; i < num_selected; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+  for(int i = 0; i < num_false; ++i)
+  {
+    ASSERT_EQUAL(omp_false[i], 3 * ref_false[i]);
+  }
+
+  // only counts the output
+  auto discarded = thrust::copy_if(thrust::omp::par, input, input + n, thrust::make_discard_iterator(), is_multiple_of{3});
+  ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), num_selected);
+
+  discarded = thrust::remove_copy_if(thrust::omp::par, input, input + n, thrust::make_discard_iterator(), is_multiple_of{3});
+  ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), n - num_selected);
+
+  auto omp_ends = thrust::stable_partition_copy(thrust::omp::par, input, input + n,
+                                                omp.begin(), thrust::make_discard_iterator(),
+                                                is_multiple_of{3});
+  ASSERT_EQUAL(omp_ends.first - omp.begin(), num_selected);
+  ASSERT_EQUAL(omp_ends.second - thrust::make_discard_iterator(), num_false);
+  for(int i = 0; i < num_selected; ++i)
+  {
+    ASSERT_EQUAL(omp[i], ref[i]);
+  }
+}
+DECLARE_UNITTEST(TestOmpCopyIfToTransformAndDiscardOutput);
@@ -0,0 +1,137 @@
+#include <unittest/unittest.h>
+
+#include <thrust/equal.h>
+#include <thrust/find.h>
+#include <thrust/mismatch.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <atomic>
+
+struct is_flagged
+{
+  const int *flags;
+
+  __host__ __device__
+  bool operator()(int x) const
+  {
+    return flags[x] != 0;
+  }
+};
+
+// counts its calls, so that a search which stops early can be told from one which doesn't
+struct counted_equal_to
+{
+  int value;
+  std::atomic<long long> *calls;
+
+  bool operator()(int x) const
+  {
+    calls->fetch_add(1, std::memory_order_relaxed);
+    return x == value;
+  }
+};
+
+struct mod_by
+{
+  int d;
+
+  __host__ __device__
+  int operator()(int x) const
+  {
+    return x % d;
+  }
+};
+
+
+// positions around the blocks of 1 << 14 elements the search polls between
+const int block_size = 1 << 14;
+
+
+void TestOmpFindIfPositions(void)
+{
+  const int n = 10 * block_size + 3;
+
+  const int positions[] = {0, 1, block_size - 1, block_size, block_size + 1,
+                           5 * block_size - 1, 5 * block_size, n - 2, n - 1};
+
+  auto input = thrust::make_counting_iterator(0);
+
+  for(int position : positions)
+  {
+    // a match at position and every position after it, so that only the first one is the answer
+    for(int stride : {1, 2 * block_size + 1, n})
+    {
+      thrust::host_vector<int> flags(n, 0);
+      for(int i = position; i < n; i += stride)
+      {
+        flags[i] = 1;
+      }
+
+      is_flagged pred = {thrust::raw_pointer_cast(flags.data())};
+
+      ASSERT_EQUAL(thrust::find_if(thrust::omp::par, input, input + n, pred) - input, position);
+      ASSERT_EQUAL(thrust::find_if_not(thrust::omp::par, flags.begin(), flags.end(), thrust::logical_not<int>()) - flags.begin(), position);
+      ASSERT_EQUAL(thrust::find(thrust::omp::par, flags.begin(), flags.end(), 1) - flags.begin(), position);
+    }
+  }
+
+  // no match
+  thrust::host_vector<int> flags(n, 0);
+  is_flagged pred = {thrust::raw_pointer_cast(flags.data())};
+  ASSERT_EQUAL(thrust::find_if(thrust::omp::par, input, input + n, pred) - input, n);
+  ASSERT_EQUAL(thrust::find(thrust::omp::par, flags.begin(), flags.end(), 1) - flags.begin(), n);
+}
+DECLARE_UNITTEST(TestOmpFindIfPositions);
+
+
+void TestOmpMismatchAndEqual(void)
+{
+  const int n = 10 * block_size + 3;
+
+  const int positions[] = {0, block_size - 1, block_size, 5 * block_size + 7, n - 1};
+
+  // the remainders of the naturals, read through an iterator which can't be written
+  auto input = thrust::make_transform_iterator(thrust::make_counting_iterator(0), mod_by{1000});
+
+  thrust::host_vector<int> copy(input, input + n);
+
+  ASSERT_EQUAL(thrust::mismatch(thrust::omp::par, input, input + n, copy.begin()).first - input, n);
+  ASSERT_EQUAL(thrust::equal(thrust::omp::par, input, input + n, copy.begin()), true);
+
+  for(int position : positions)
+  {
+    thrust::host_vector<int> other = copy;
+    other[position] = -1;
+    other[n - 1]    = -1;
+
+    auto ends = thrust::mismatch(thrust::omp::par, input, input + n, other.begin());
+    ASSERT_EQUAL(ends.first - input, position);
+    ASSERT_EQUAL(ends.second - other.begin(), position);
+    ASSERT_EQUAL(thrust::equal(thrust::omp::par, input, input + n, other.begin()), false);
+  }
+}
+DECLARE_UNITTEST(TestOmpMismatchAndEqual);
+
+
+void TestOmpFindIfExitsEarly(void)
+{
+  const int n = 1 << 24;
+
+  auto input = thrust::make_counting_iterator(0);
+
+  std::atomic<long long> calls(0);
+
+  // a match in the first block leaves most of the later blocks unexamined
+  counted_equal_to pred = {10, &calls};
+  ASSERT_EQUAL(thrust::find_if(thrust::omp::par, input, input + n, pred) - input, 10);
+  ASSERT_LESS(calls.load(), static_cast<long long>(n / 2));
+
+  // and a match near the end leaves the blocks after it unexamined
+  calls = 0;
+  pred.value = n / 2;
+  ASSERT_EQUAL(thrust::find_if(thrust::omp::par, input, input + n, pred) - input, n / 2);
+  ASSERT_LESS(calls.load(), static_cast<long long>(n));
+}
+DECLARE_UNITTEST(TestOmpFindIfExitsEarly);
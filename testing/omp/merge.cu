@@ -0,0 +1,196 @@
+#include <unittest/unittest.h>
+
+#include <thrust/merge.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+// compares only the high bits, so that the low bits tell which input an element came from
+// and equivalent elements of both inputs can be told apart
+struct less_high_bits
+{
+  __host__ __device__
+  bool operator()(long long x, long long y) const
+  {
+    return (x >> 20) < (y >> 20);
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+struct div_by
+{
+  long long d;
+
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return x / d;
+  }
+};
+
+
+// n sorted keys in [offset, offset + range), each tagged in its low bits with its input and position
+thrust::host_vector<long long> make_sorted_keys(int n, long long range, long long offset, int input)
+{
+  thrust::host_vector<long long> keys(n);
+
+  unsigned int state = 12345u + input;
+
+  for(int i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+    keys[i] = offset + (state >> 8) % range;
+  }
+
+  thrust::sort(thrust::seq, keys.begin(), keys.end());
+
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = (keys[i] << 20) | (input << 19) | i;
+  }
+
+  return keys;
+}
+
+
+void check_merge(const thrust::host_vector<long long> &keys1,
+                 const thrust::host_vector<long long> &keys2)
+{
+  const int n = static_cast<int>(keys1.size() + keys2.size());
+
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  thrust::merge(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  auto omp_end = thrust::merge(thrust::omp::par, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), omp.begin(), less_high_bits());
+
+  ASSERT_EQUAL(omp_end - omp.begin(), n);
+  ASSERT_EQUAL(omp, ref);
+
+  // the values record the position of every key in its input
+  thrust::host_vector<int> values1(keys1.size()), values2(keys2.size());
+  for(size_t i = 0; i < keys1.size(); ++i) values1[i] = static_cast<int>(i);
+  for(size_t i = 0; i < keys2.size(); ++i) values2[i] = -static_cast<int>(i) - 1;
+
+  thrust::host_vector<long long> ref_keys(n), omp_keys(n);
+  thrust::host_vector<int> ref_values(n), omp_values(n);
+
+  thrust::merge_by_key(thrust::seq,
+                       keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                       values1.begin(), values2.begin(),
+                       ref_keys.begin(), ref_values.begin(),
+                       less_high_bits());
+  auto omp_ends = thrust::merge_by_key(thrust::omp::par,
+                                       keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                                       values1.begin(), values2.begin(),
+                                       omp_keys.begin(), omp_values.begin(),
+                                       less_high_bits());
+
+  ASSERT_EQUAL(omp_ends.first - omp_keys.begin(), n);
+  ASSERT_EQUAL(omp_ends.second - omp_values.begin(), n);
+  ASSERT_EQUAL(omp_keys, ref_keys);
+  ASSERT_EQUAL(omp_values, ref_values);
+}
+
+
+void TestOmpMergeInputs(void)
+{
+  const int n = 100003;
+
+  struct merge_case
+  {
+    int n1, n2;
+    long long range, offset1, offset2;
+  };
+
+  const merge_case cases[] =
+  {
+    {n, n + 17,   1 << 30, 0,    0},     // interleaved
+    {n, n,        100,     0,    0},     // many equivalent keys in both inputs
+    {n, n,        1,       0,    0},     // every key equivalent
+    {n, n,        1000,    0,    1000},  // every key of the first input before the second
+    {n, n,        1000,    1000, 0},     // every key of the second input before the first
+    {n, 0,        1 << 30, 0,    0},     // an empty input
+    {0, n,        1 << 30, 0,    0},
+    {3, 2 * n,    1 << 30, 0,    0},     // skewed sizes
+    {2 * n, 1,    1 << 30, 0,    0},
+    {4999, 5000,  1 << 30, 0,    0},     // on both sides of the threshold of 10000 elements
+    {5000, 5001,  1 << 30, 0,    0}      // below which the calling thread merges alone
+  };
+
+  for(const merge_case &c : cases)
+  {
+    check_merge(make_sorted_keys(c.n1, c.range, c.offset1, 0),
+                make_sorted_keys(c.n2, c.range, c.offset2, 1));
+  }
+}
+DECLARE_UNITTEST(TestOmpMergeInputs);
+
+
+void TestOmpMergeCountingInput(void)
+{
+  const int n = 100003;
+
+  // the multiples of three and the naturals, read through iterators which can't be written
+  auto threes = thrust::make_transform_iterator(thrust::make_counting_iterator<long long>(0), times_three());
+  auto naturals = thrust::make_counting_iterator<long long>(0);
+
+  thrust::host_vector<long long> ref(2 * n), omp(2 * n);
+
+  thrust::merge(thrust::seq, threes, threes + n, naturals, naturals + n, ref.begin());
+  thrust::merge(thrust::omp::par, threes, threes + n, naturals, naturals + n, omp.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  thrust::host_vector<long long> ref_values(2 * n), omp_values(2 * n);
+
+  auto values1 = thrust::make_transform_iterator(thrust::make_counting_iterator<long long>(0), div_by{7});
+  auto values2 = thrust::make_counting_iterator<long long>(-n);
+
+  thrust::merge_by_key(thrust::seq, threes, threes + n, naturals, naturals + n, values1, values2, ref.begin(), ref_values.begin());
+  thrust::merge_by_key(thrust::omp::par, threes, threes + n, naturals, naturals + n, values1, values2, omp.begin(), omp_values.begin());
+  ASSERT_EQUAL(omp, ref);
+  ASSERT_EQUAL(omp_values, ref_values);
+}
+DECLARE_UNITTEST(TestOmpMergeCountingInput);
+
+
+void TestOmpMergeToTransformAndDiscardOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> keys1 = make_sorted_keys(n, 1000, 0, 0);
+  thrust::host_vector<long long> keys2 = make_sorted_keys(n, 1000, 0, 1);
+
+  thrust::host_vector<long long> ref(2 * n), omp(2 * n);
+
+  // every output is written exactly once, so it is tripled exactly once
+  thrust::merge(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  thrust::merge(thrust::omp::par, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                thrust::make_transform_output_iterator(omp.begin(), times_three()), less_high_bits());
+  for(int i = 0; i < 2 * n; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+
+  auto values = thrust::make_counting_iterator<long long>(0);
+
+  auto ends = thrust::merge_by_key(thrust::omp::par,
+                                   keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                                   values, values,
+                                   omp.begin(), thrust::make_discard_iterator(),
+                                   less_high_bits());
+  ASSERT_EQUAL(ends.first - omp.begin(), 2 * n);
+  ASSERT_EQUAL(ends.second - thrust::make_discard_iterator(), 2 * n);
+  ASSERT_EQUAL(omp, ref);
+}
+DECLARE_UNITTEST(TestOmpMergeToTransformAndDiscardOutput);
@@ -0,0 +1,136 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <limits>
+
+// above the radix sort threshold of 1 << 16, and not a multiple of the number of tiles
+const int sizes[] = {(1 << 16) + 3, 200003};
+
+
+// keys spread over the whole range of T, with some repeated, so that
+// stable_sort_by_key shows whether equivalent keys keep their order
+template<typename T>
+thrust::host_vector<T> make_keys(int n, unsigned int seed)
+{
+  thrust::host_vector<T> keys(n);
+
+  unsigned long long state = seed;
+
+  for(int i = 0; i < n; ++i)
+  {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+
+    // every eighth key repeats the one before it
+    if(i % 8 == 7)
+    {
+      keys[i] = keys[i - 1];
+    }
+    else
+    {
+      keys[i] = static_cast<T>(static_cast<long long>(state >> 1));
+    }
+  }
+
+  return keys;
+}
+
+
+template<>
+thrust::host_vector<float> make_keys<float>(int n, unsigned int seed)
+{
+  thrust::host_vector<int> ints = make_keys<int>(n, seed);
+  thrust::host_vector<float> keys(n);
+
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<float>(ints[i]) / 1024.0f;
+  }
+
+  // signed zeros and infinities
+  keys[0] = -0.0f;
+  keys[1] = 0.0f;
+  keys[2] = std::numeric_limits<float>::infinity();
+  keys[3] = -std::numeric_limits<float>::infinity();
+
+  return keys;
+}
+
+
+template<>
+thrust::host_vector<double> make_keys<double>(int n, unsigned int seed)
+{
+  thrust::host_vector<long long> ints = make_keys<long long>(n, seed);
+  thrust::host_vector<double> keys(n);
+
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<double>(ints[i]) / 3.0;
+  }
+
+  keys[0] = -0.0;
+  keys[1] = 0.0;
+  keys[2] = std::numeric_limits<double>::infinity();
+  keys[3] = -std::numeric_limits<double>::infinity();
+
+  return keys;
+}
+
+
+template<typename T, typename Compare>
+void check_radix_sort(const thrust::host_vector<T> &input, Compare comp)
+{
+  const int n = static_cast<int>(input.size());
+
+  thrust::host_vector<T> ref = input, omp = input;
+  thrust::stable_sort(thrust::seq, ref.begin(), ref.end(), comp);
+  thrust::stable_sort(thrust::omp::par, omp.begin(), omp.end(), comp);
+  ASSERT_EQUAL(omp, ref);
+
+  thrust::host_vector<T> ref_keys = input, omp_keys = input;
+  thrust::host_vector<int> ref_values(n), omp_values(n);
+  for(int i = 0; i < n; ++i)
+  {
+    ref_values[i] = omp_values[i] = i;
+  }
+
+  thrust::stable_sort_by_key(thrust::seq, ref_keys.begin(), ref_keys.end(), ref_values.begin(), comp);
+  thrust::stable_sort_by_key(thrust::omp::par, omp_keys.begin(), omp_keys.end(), omp_values.begin(), comp);
+  ASSERT_EQUAL(omp_keys, ref_keys);
+  ASSERT_EQUAL(omp_values, ref_values);
+}
+
+
+template<typename T>
+struct TestOmpRadixSort
+{
+  void operator()(void)
+  {
+    for(int n : sizes)
+    {
+      thrust::host_vector<T> keys = make_keys<T>(n, 1);
+
+      check_radix_sort(keys, thrust::less<T>());
+      check_radix_sort(keys, thrust::greater<T>());
+
+      // keys in a small range, for which the passes over the digits every key shares are skipped
+      thrust::host_vector<T> low_keys(n);
+      for(int i = 0; i < n; ++i)
+      {
+        low_keys[i] = static_cast<T>((i * 37) % 100);
+      }
+
+      check_radix_sort(low_keys, thrust::less<T>());
+      check_radix_sort(low_keys, thrust::greater<T>());
+
+      // presorted and reversed keys
+      thrust::stable_sort(thrust::seq, keys.begin(), keys.end());
+      check_radix_sort(keys, thrust::less<T>());
+      check_radix_sort(keys, thrust::greater<T>());
+    }
+  }
+};
+SimpleUnitTest<TestOmpRadixSort, BuiltinNumericTypes > TestOmpRadixSortInstance;
+
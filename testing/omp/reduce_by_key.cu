@@ -0,0 +1,154 @@
+#include <unittest/unittest.h>
+
+#include <thrust/reduce.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+struct div_by
+{
+  int d;
+
+  __host__ __device__
+  int operator()(int x) const
+  {
+    return x / d;
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// keys with segments of the given length, which span many tiles when the length is large
+thrust::host_vector<int> make_segmented_keys(int n, int segment_length)
+{
+  thrust::host_vector<int> keys(n);
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = i / segment_length;
+  }
+  return keys;
+}
+
+
+void TestOmpReduceByKeySegmentLengths(void)
+{
+  // on both sides of the threshold of 10000 elements below which the calling thread reduces alone
+  for(int n : {9999, 10001, 100003})
+  {
+    const int segment_lengths[] = {1, 7, 1000, 40000, n};
+
+    for(int segment_length : segment_lengths)
+    {
+      thrust::host_vector<int> keys = make_segmented_keys(n, segment_length);
+      thrust::host_vector<long long> values(thrust::make_counting_iterator(0), thrust::make_counting_iterator(n));
+
+      thrust::host_vector<int> ref_keys(n), omp_keys(n);
+      thrust::host_vector<long long> ref_values(n), omp_values(n);
+
+      auto ref_end = thrust::reduce_by_key(thrust::seq,
+                                           keys.begin(), keys.end(), values.begin(),
+                                           ref_keys.begin(), ref_values.begin());
+      auto omp_end = thrust::reduce_by_key(thrust::omp::par,
+                                           keys.begin(), keys.end(), values.begin(),
+                                           omp_keys.begin(), omp_values.begin());
+
+      ASSERT_EQUAL(omp_end.first - omp_keys.begin(), ref_end.first - ref_keys.begin());
+      ASSERT_EQUAL(omp_end.second - omp_values.begin(), ref_end.second - ref_values.begin());
+      ASSERT_EQUAL(omp_keys, ref_keys);
+      ASSERT_EQUAL(omp_values, ref_values);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpReduceByKeySegmentLengths);
+
+
+void TestOmpReduceByKeyCountingInput(void)
+{
+  const int n = 100003;
+
+  // segments of 5000 elements, read through iterators which can't be written
+  auto keys_first   = thrust::make_transform_iterator(thrust::make_counting_iterator(0), div_by{5000});
+  auto values_first = thrust::make_counting_iterator<long long>(0);
+
+  thrust::host_vector<int> ref_keys(n), omp_keys(n);
+  thrust::host_vector<long long> ref_values(n), omp_values(n);
+
+  auto ref_end = thrust::reduce_by_key(thrust::seq,
+                                       keys_first, keys_first + n, values_first,
+                                       ref_keys.begin(), ref_values.begin());
+  auto omp_end = thrust::reduce_by_key(thrust::omp::par,
+                                       keys_first, keys_first + n, values_first,
+                                       omp_keys.begin(), omp_values.begin());
+
+  ASSERT_EQUAL(omp_end.first - omp_keys.begin(), ref_end.first - ref_keys.begin());
+  ASSERT_EQUAL(omp_keys, ref_keys);
+  ASSERT_EQUAL(omp_values, ref_values);
+}
+DECLARE_UNITTEST(TestOmpReduceByKeyCountingInput);
+
+
+void TestOmpReduceByKeyToDiscardValues(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<int> keys = make_segmented_keys(n, 3000);
+  thrust::host_vector<long long> values(thrust::make_counting_iterator(0), thrust::make_counting_iterator(n));
+
+  thrust::host_vector<int> omp_keys(n);
+
+  auto omp_end = thrust::reduce_by_key(thrust::omp::par,
+                                       keys.begin(), keys.end(), values.begin(),
+                                       omp_keys.begin(), thrust::make_discard_iterator());
+
+  const int num_segments = (n + 2999) / 3000;
+  ASSERT_EQUAL(omp_end.first - omp_keys.begin(), num_segments);
+  ASSERT_EQUAL(omp_end.second - thrust::make_discard_iterator(), num_segments);
+
+  for(int i = 0; i < num_segments; ++i)
+  {
+    ASSERT_EQUAL(omp_keys[i], i);
+  }
+}
+DECLARE_UNITTEST(TestOmpReduceByKeyToDiscardValues);
+
+
+void TestOmpReduceByKeyToTransformOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<int> keys = make_segmented_keys(n, 3000);
+  thrust::host_vector<long long> values(thrust::make_counting_iterator(0), thrust::make_counting_iterator(n));
+
+  thrust::host_vector<int> ref_keys(n), omp_keys(n);
+  thrust::host_vector<long long> ref_values(n), omp_values(n);
+
+  auto ref_end = thrust::reduce_by_key(thrust::seq,
+                                       keys.begin(), keys.end(), values.begin(),
+                                       ref_keys.begin(), ref_values.begin());
+
+  // every output value is written exactly once, so it is tripled exactly once
+  auto omp_end = thrust::reduce_by_key(thrust::omp::par,
+                                       keys.begin(), keys.end(), values.begin(),
+                                       omp_keys.begin(),
+                                       thrust::make_transform_output_iterator(omp_values.begin(), times_three()));
+
+  const int num_segments = static_cast<int>(ref_end.first - ref_keys.begin());
+  ASSERT_EQUAL(omp_end.first - omp_keys.begin(), num_segments);
+  ASSERT_EQUAL(omp_keys, ref_keys);
+
+  for(int i = 0; i < num_segments; ++i)
+  {
+    ASSERT_EQUAL(omp_values[i], 3 * ref_values[i]);
+  }
+}
+DECLARE_UNITTEST(TestOmpReduceByKeyToTransformOutput);
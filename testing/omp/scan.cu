@@ -0,0 +1,169 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+// associative but not commutative, so every tile must be seeded with the carry of the
+// tiles before it and combined on the correct side
+struct first_of
+{
+  __host__ __device__
+  long long operator()(long long x, long long) const
+  {
+    return x;
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// on both sides of the threshold of 10000 elements below which the calling thread
+// scans alone, and not a multiple of the number of tiles
+const int sizes[] = {4097, 9999, 10001, (1 << 16) + 3, 100003};
+
+
+// values which aren't monotonic, so that a maximum scan changes within and across tiles
+thrust::host_vector<long long> make_values(int n)
+{
+  thrust::host_vector<long long> values(n);
+  for(int i = 0; i < n; ++i)
+  {
+    values[i] = (static_cast<long long>(i) * 7919) % 100003 - 50000;
+  }
+  return values;
+}
+
+
+template<typename BinaryFunction>
+void check_scans(const thrust::host_vector<long long> &values, BinaryFunction binary_op)
+{
+  const int n = static_cast<int>(values.size());
+
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  thrust::inclusive_scan(thrust::seq, values.begin(), values.end(), ref.begin(), binary_op);
+  auto omp_end = thrust::inclusive_scan(thrust::omp::par, values.begin(), values.end(), omp.begin(), binary_op);
+  ASSERT_EQUAL(omp_end - omp.begin(), n);
+  ASSERT_EQUAL(omp, ref);
+
+  thrust::exclusive_scan(thrust::seq, values.begin(), values.end(), ref.begin(), 13ll, binary_op);
+  omp_end = thrust::exclusive_scan(thrust::omp::par, values.begin(), values.end(), omp.begin(), 13ll, binary_op);
+  ASSERT_EQUAL(omp_end - omp.begin(), n);
+  ASSERT_EQUAL(omp, ref);
+}
+
+
+void TestOmpScanOperators(void)
+{
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> values = make_values(n);
+
+    check_scans(values, thrust::plus<long long>());
+    check_scans(values, thrust::maximum<long long>());
+    check_scans(values, first_of());
+  }
+}
+DECLARE_UNITTEST(TestOmpScanOperators);
+
+
+void TestOmpScanInPlace(void)
+{
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> values = make_values(n);
+    thrust::host_vector<long long> ref(n);
+
+    thrust::host_vector<long long> omp = values;
+    thrust::inclusive_scan(thrust::seq, values.begin(), values.end(), ref.begin());
+    thrust::inclusive_scan(thrust::omp::par, omp.begin(), omp.end(), omp.begin());
+    ASSERT_EQUAL(omp, ref);
+
+    omp = values;
+    thrust::exclusive_scan(thrust::seq, values.begin(), values.end(), ref.begin(), 13ll);
+    thrust::exclusive_scan(thrust::omp::par, omp.begin(), omp.end(), omp.begin(), 13ll);
+    ASSERT_EQUAL(omp, ref);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanInPlace);
+
+
+void TestOmpScanCountingInput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> inclusive(n), exclusive(n);
+
+  thrust::inclusive_scan(thrust::omp::par,
+                         thrust::make_counting_iterator<long long>(0),
+                         thrust::make_counting_iterator<long long>(n),
+                         inclusive.begin());
+  thrust::exclusive_scan(thrust::omp::par,
+                         thrust::make_counting_iterator<long long>(0),
+                         thrust::make_counting_iterator<long long>(n),
+                         exclusive.begin(),
+                         10ll);
+
+  for(long long i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(inclusive[i], i * (i + 1) / 2);
+    ASSERT_EQUAL(exclusive[i], 10 + i * (i - 1) / 2);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanCountingInput);
+
+
+void TestOmpScanToTransformOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> values = make_values(n);
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  // every output is written exactly once, so it is tripled exactly once
+  thrust::inclusive_scan(thrust::seq, values.begin(), values.end(), ref.begin());
+  thrust::inclusive_scan(thrust::omp::par, values.begin(), values.end(),
+                         thrust::make_transform_output_iterator(omp.begin(), times_three()));
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+
+  thrust::exclusive_scan(thrust::seq, values.begin(), values.end(), ref.begin(), 13ll);
+  thrust::exclusive_scan(thrust::omp::par, values.begin(), values.end(),
+                         thrust::make_transform_output_iterator(omp.begin(), times_three()), 13ll);
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanToTransformOutput);
+
+
+void TestOmpScanToDiscardOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> values = make_values(n);
+
+  auto inclusive_end = thrust::inclusive_scan(thrust::omp::par, values.begin(), values.end(),
+                                              thrust::make_discard_iterator());
+  auto exclusive_end = thrust::exclusive_scan(thrust::omp::par, values.begin(), values.end(),
+                                              thrust::make_discard_iterator(), 13ll);
+
+  ASSERT_EQUAL(inclusive_end - thrust::make_discard_iterator(), n);
+  ASSERT_EQUAL(exclusive_end - thrust::make_discard_iterator(), n);
+}
+DECLARE_UNITTEST(TestOmpScanToDiscardOutput);
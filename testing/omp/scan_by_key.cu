@@ -0,0 +1,240 @@
+#include <unittest/unittest.h>
+
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+#include <thrust/transform_scan.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+struct div_by
+{
+  long long d;
+
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return x / d;
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+// associative but not commutative, so every tile must be seeded with the carry of the
+// tiles before it and combined on the correct side
+struct first_of
+{
+  __host__ __device__
+  long long operator()(long long x, long long) const
+  {
+    return x;
+  }
+};
+
+
+// keys with segments of the given length, which span many tiles when the length is large
+thrust::host_vector<long long> make_segmented_keys(int n, int segment_length)
+{
+  thrust::host_vector<long long> keys(n);
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = i / segment_length;
+  }
+  return keys;
+}
+
+
+thrust::host_vector<long long> make_values(int n)
+{
+  thrust::host_vector<long long> values(n);
+  for(int i = 0; i < n; ++i)
+  {
+    values[i] = (static_cast<long long>(i) * 7919) % 100003 - 50000;
+  }
+  return values;
+}
+
+
+template<typename BinaryFunction>
+void check_scans_by_key(const thrust::host_vector<long long> &keys,
+                        const thrust::host_vector<long long> &values,
+                        BinaryFunction binary_op)
+{
+  const int n = static_cast<int>(keys.size());
+
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  thrust::inclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin(),
+                                thrust::equal_to<long long>(), binary_op);
+  auto omp_end = thrust::inclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(), omp.begin(),
+                                               thrust::equal_to<long long>(), binary_op);
+  ASSERT_EQUAL(omp_end - omp.begin(), n);
+  ASSERT_EQUAL(omp, ref);
+
+  thrust::exclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin(),
+                                13ll, thrust::equal_to<long long>(), binary_op);
+  omp_end = thrust::exclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(), omp.begin(),
+                                          13ll, thrust::equal_to<long long>(), binary_op);
+  ASSERT_EQUAL(omp_end - omp.begin(), n);
+  ASSERT_EQUAL(omp, ref);
+}
+
+
+void TestOmpScanByKeySegmentLengths(void)
+{
+  // on both sides of the threshold of 10000 elements below which the calling thread scans alone
+  for(int n : {9999, 10001, 100003})
+  {
+    const int segment_lengths[] = {1, 7, 1000, 40000, n};
+
+    thrust::host_vector<long long> values = make_values(n);
+
+    for(int segment_length : segment_lengths)
+    {
+      thrust::host_vector<long long> keys = make_segmented_keys(n, segment_length);
+
+      check_scans_by_key(keys, values, thrust::plus<long long>());
+      check_scans_by_key(keys, values, thrust::maximum<long long>());
+      check_scans_by_key(keys, values, first_of());
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpScanByKeySegmentLengths);
+
+
+void TestOmpScanByKeyInPlace(void)
+{
+  const int n = (1 << 16) + 3;
+
+  thrust::host_vector<long long> keys   = make_segmented_keys(n, 3000);
+  thrust::host_vector<long long> values = make_values(n);
+  thrust::host_vector<long long> ref(n);
+
+  // the output may alias the values
+  thrust::host_vector<long long> omp = values;
+  thrust::inclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin());
+  thrust::inclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), omp.begin(), omp.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  omp = values;
+  thrust::exclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin(), 13ll);
+  thrust::exclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), omp.begin(), omp.begin(), 13ll);
+  ASSERT_EQUAL(omp, ref);
+
+  // or the keys
+  omp = keys;
+  thrust::inclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin());
+  thrust::inclusive_scan_by_key(thrust::omp::par, omp.begin(), omp.end(), values.begin(), omp.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  omp = keys;
+  thrust::exclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin(), 13ll);
+  thrust::exclusive_scan_by_key(thrust::omp::par, omp.begin(), omp.end(), values.begin(), omp.begin(), 13ll);
+  ASSERT_EQUAL(omp, ref);
+}
+DECLARE_UNITTEST(TestOmpScanByKeyInPlace);
+
+
+void TestOmpScanByKeyCountingInput(void)
+{
+  const int n = 100003;
+
+  // segments of 5000 elements, read through iterators which can't be written
+  auto keys_first   = thrust::make_transform_iterator(thrust::make_counting_iterator<long long>(0), div_by{5000});
+  auto values_first = thrust::make_counting_iterator<long long>(0);
+
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  thrust::inclusive_scan_by_key(thrust::seq, keys_first, keys_first + n, values_first, ref.begin());
+  thrust::inclusive_scan_by_key(thrust::omp::par, keys_first, keys_first + n, values_first, omp.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  thrust::exclusive_scan_by_key(thrust::seq, keys_first, keys_first + n, values_first, ref.begin(), 13ll);
+  thrust::exclusive_scan_by_key(thrust::omp::par, keys_first, keys_first + n, values_first, omp.begin(), 13ll);
+  ASSERT_EQUAL(omp, ref);
+}
+DECLARE_UNITTEST(TestOmpScanByKeyCountingInput);
+
+
+void TestOmpScanByKeyToTransformOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> keys   = make_segmented_keys(n, 3000);
+  thrust::host_vector<long long> values = make_values(n);
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  // every output is written exactly once, so it is tripled exactly once
+  thrust::inclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin());
+  thrust::inclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(),
+                                thrust::make_transform_output_iterator(omp.begin(), times_three()));
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+
+  thrust::exclusive_scan_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), ref.begin(), 13ll);
+  thrust::exclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(),
+                                thrust::make_transform_output_iterator(omp.begin(), times_three()), 13ll);
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanByKeyToTransformOutput);
+
+
+void TestOmpScanByKeyToDiscardOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> keys   = make_segmented_keys(n, 3000);
+  thrust::host_vector<long long> values = make_values(n);
+
+  auto inclusive_end = thrust::inclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(),
+                                                     thrust::make_discard_iterator());
+  auto exclusive_end = thrust::exclusive_scan_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(),
+                                                     thrust::make_discard_iterator(), 13ll);
+
+  ASSERT_EQUAL(inclusive_end - thrust::make_discard_iterator(), n);
+  ASSERT_EQUAL(exclusive_end - thrust::make_discard_iterator(), n);
+}
+DECLARE_UNITTEST(TestOmpScanByKeyToDiscardOutput);
+
+
+void TestOmpTransformScanCountingInput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  thrust::transform_inclusive_scan(thrust::seq,
+                                   thrust::make_counting_iterator<long long>(0),
+                                   thrust::make_counting_iterator<long long>(n),
+                                   ref.begin(), times_three(), thrust::maximum<long long>());
+  thrust::transform_inclusive_scan(thrust::omp::par,
+                                   thrust::make_counting_iterator<long long>(0),
+                                   thrust::make_counting_iterator<long long>(n),
+                                   omp.begin(), times_three(), thrust::maximum<long long>());
+  ASSERT_EQUAL(omp, ref);
+
+  thrust::transform_exclusive_scan(thrust::seq,
+                                   thrust::make_counting_iterator<long long>(0),
+                                   thrust::make_counting_iterator<long long>(n),
+                                   ref.begin(), times_three(), 13ll, thrust::plus<long long>());
+  thrust::transform_exclusive_scan(thrust::omp::par,
+                                   thrust::make_counting_iterator<long long>(0),
+                                   thrust::make_counting_iterator<long long>(n),
+                                   omp.begin(), times_three(), 13ll, thrust::plus<long long>());
+  ASSERT_EQUAL(omp, ref);
+}
+DECLARE_UNITTEST(TestOmpTransformScanCountingInput);
@@ -0,0 +1,103 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/transform.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <omp.h>
+
+struct record_thread
+{
+  int *thread_ids;
+
+  void operator()(int i) const
+  {
+    thread_ids[i] = omp_get_thread_num();
+  }
+};
+
+
+void TestOmpForEachSmallInputRunsInline(void)
+{
+  const int n = 100;
+
+  thrust::host_vector<int> input(n);
+  thrust::sequence(input.begin(), input.end());
+
+  thrust::host_vector<int> thread_ids(n, -1);
+
+  thrust::for_each(thrust::omp::par, input.begin(), input.end(), record_thread{thrust::raw_pointer_cast(thread_ids.data())});
+
+  ASSERT_EQUAL(thread_ids, thrust::host_vector<int>(n, 0));
+}
+DECLARE_UNITTEST(TestOmpForEachSmallInputRunsInline);
+
+
+void TestOmpForEachSchedule(void)
+{
+  const int n = 1000;
+  const int chunk_size = 7;
+
+  thrust::host_vector<int> input(n);
+  thrust::sequence(input.begin(), input.end());
+
+  thrust::host_vector<int> thread_ids(n, -1);
+
+  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_dynamic, chunk_size),
+                   input.begin(), input.end(),
+                   record_thread{thrust::raw_pointer_cast(thread_ids.data())});
+
+  // every chunk is processed by a single thread
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(thread_ids[i] >= 0, true);
+    ASSERT_EQUAL(thread_ids[i], thread_ids[i - i % chunk_size]);
+  }
+
+  // the schedule of the calling thread is left unchanged
+  omp_sched_t kind_before, kind_after;
+  int chunk_size_before, chunk_size_after;
+
+  omp_get_schedule(&kind_before, &chunk_size_before);
+  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_guided),
+                   input.begin(), input.end(),
+                   record_thread{thrust::raw_pointer_cast(thread_ids.data())});
+  omp_get_schedule(&kind_after, &chunk_size_after);
+
+  ASSERT_EQUAL(kind_before == kind_after, true);
+  ASSERT_EQUAL(chunk_size_before, chunk_size_after);
+}
+DECLARE_UNITTEST(TestOmpForEachSchedule);
+
+
+void TestOmpScheduleWithAllocator(void)
+{
+  const int n = 10000;
+
+  thrust::host_vector<int> input(n);
+  thrust::sequence(input.begin(), input.end());
+
+  thrust::host_vector<int> output(n);
+
+  std::allocator<int> alloc;
+
+  // the allocator is given after the schedule, which leaves the type of par(alloc) unchanged
+  thrust::transform(thrust::omp::par.schedule(thrust::omp::schedule_static, 128)(alloc),
+                    input.begin(), input.end(),
+                    output.begin(),
+                    thrust::negate<int>());
+
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(output[i], -i);
+  }
+
+  // and the policy with the allocator keeps the schedule
+  thrust::system::omp::detail::schedule_t schedule =
+    get_schedule(thrust::omp::par.schedule(thrust::omp::schedule_guided, 64)(alloc));
+  ASSERT_EQUAL(schedule.is_specified, true);
+  ASSERT_EQUAL(schedule.kind == thrust::omp::schedule_guided, true);
+  ASSERT_EQUAL(schedule.chunk_size, 64);
+}
+DECLARE_UNITTEST(TestOmpScheduleWithAllocator);
@@ -0,0 +1,222 @@
+#include <unittest/unittest.h>
+
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// fills every allocation with the largest ptrdiff_t, so that any count or offset which
+// is read before it is written adds up past the largest value, which sanitizer builds report
+template<typename T>
+struct poisoning_allocator : std::allocator<T>
+{
+  typedef T value_type;
+
+  poisoning_allocator() {}
+
+  template<typename U>
+  poisoning_allocator(const poisoning_allocator<U> &) {}
+
+  template<typename U>
+  struct rebind
+  {
+    typedef poisoning_allocator<U> other;
+  };
+
+  T *allocate(std::size_t n)
+  {
+    T *p = std::allocator<T>::allocate(n);
+
+    std::ptrdiff_t *words = reinterpret_cast<std::ptrdiff_t *>(p);
+    for(std::size_t i = 0; i < n * sizeof(T) / sizeof(std::ptrdiff_t); ++i)
+    {
+      words[i] = (std::numeric_limits<std::ptrdiff_t>::max)();
+    }
+
+    return p;
+  }
+};
+
+
+// n sorted keys in [offset, offset + range), which repeat when n is larger than the range
+thrust::host_vector<long long> make_sorted_keys(int n, long long range, long long offset, unsigned int seed)
+{
+  thrust::host_vector<long long> keys(n);
+
+  unsigned int state = seed;
+
+  for(int i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+    keys[i] = offset + (state >> 8) % range;
+  }
+
+  thrust::sort(thrust::seq, keys.begin(), keys.end());
+
+  return keys;
+}
+
+
+template<typename ExecutionPolicy>
+void check_set_operations(ExecutionPolicy policy,
+                          const thrust::host_vector<long long> &keys1,
+                          const thrust::host_vector<long long> &keys2)
+{
+  const int n = static_cast<int>(keys1.size() + keys2.size());
+
+  thrust::host_vector<long long> ref(n), omp(n);
+
+  auto ref_end = thrust::set_union(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin());
+  auto omp_end = thrust::set_union(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::set_intersection(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin());
+  omp_end = thrust::set_intersection(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::set_difference(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin());
+  omp_end = thrust::set_difference(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::set_symmetric_difference(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin());
+  omp_end = thrust::set_symmetric_difference(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+}
+
+
+void TestOmpSetOperationsInputs(void)
+{
+  const int n = 100003;
+
+  struct set_case
+  {
+    int n1, n2;
+    long long range1, range2, offset2;
+  };
+
+  const set_case cases[] =
+  {
+    {n, n + 17, 1 << 30, 1 << 30, 0},     // few common keys
+    {n, n,      n,       n,       0},     // many common keys
+    {n, n,      100,     100,     0},     // keys repeated many times in both inputs
+    {n, n,      1,       1,       0},     // a single key
+    {n, n,      1000,    1000,    1000},  // every key of the first input before the second
+    {n, n,      1000,    1000,    -1000}, // every key of the second input before the first
+    {n, 0,      n,       n,       0},     // an empty input
+    {0, n,      n,       n,       0},
+    {5, 2 * n,  n,       n,       0},     // skewed sizes
+    {2 * n, 5,  n,       n,       0},
+    {2 * n, n,  n,       n / 2,   n / 4}  // the second input within the range of the first
+  };
+
+  for(const set_case &c : cases)
+  {
+    thrust::host_vector<long long> keys1 = make_sorted_keys(c.n1, c.range1, 0,         1);
+    thrust::host_vector<long long> keys2 = make_sorted_keys(c.n2, c.range2, c.offset2, 2);
+
+    check_set_operations(thrust::omp::par, keys1, keys2);
+  }
+}
+DECLARE_UNITTEST(TestOmpSetOperationsInputs);
+
+
+void TestOmpSetOperationsPoisonedTemporaries(void)
+{
+  // inputs of 2 * n + 1 elements in total, on both sides of the threshold of 10000 elements
+  // below which the calling thread does all the work
+  const int sizes[] = {4999, 5000, (1 << 16) + 3, 100003};
+
+  poisoning_allocator<long long> alloc;
+
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> keys1 = make_sorted_keys(n, n, 0, 1);
+    thrust::host_vector<long long> keys2 = make_sorted_keys(n + 1, n, 0, 2);
+
+    check_set_operations(thrust::omp::par(alloc), keys1, keys2);
+  }
+}
+DECLARE_UNITTEST(TestOmpSetOperationsPoisonedTemporaries);
+
+
+void TestOmpSetOperationsCountingInput(void)
+{
+  const int n = 100003;
+
+  // the multiples of three and the naturals, read through iterators which can't be written
+  auto threes   = thrust::make_transform_iterator(thrust::make_counting_iterator<long long>(0), times_three());
+  auto naturals = thrust::make_counting_iterator<long long>(0);
+
+  thrust::host_vector<long long> ref(2 * n), omp(2 * n);
+
+  auto ref_end = thrust::set_union(thrust::seq, threes, threes + n, naturals, naturals + n, ref.begin());
+  auto omp_end = thrust::set_union(thrust::omp::par, threes, threes + n, naturals, naturals + n, omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::set_intersection(thrust::seq, threes, threes + n, naturals, naturals + n, ref.begin());
+  omp_end = thrust::set_intersection(thrust::omp::par, threes, threes + n, naturals, naturals + n, omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::set_difference(thrust::seq, threes, threes + n, naturals, naturals + n, ref.begin());
+  omp_end = thrust::set_difference(thrust::omp::par, threes, threes + n, naturals, naturals + n, omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+
+  ref_end = thrust::set_symmetric_difference(thrust::seq, threes, threes + n, naturals, naturals + n, ref.begin());
+  omp_end = thrust::set_symmetric_difference(thrust::omp::par, threes, threes + n, naturals, naturals + n, omp.begin());
+  ASSERT_EQUAL(omp_end - omp.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(omp, ref);
+}
+DECLARE_UNITTEST(TestOmpSetOperationsCountingInput);
+
+
+void TestOmpSetOperationsToTransformAndDiscardOutput(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<long long> keys1 = make_sorted_keys(n, n, 0, 1);
+  thrust::host_vector<long long> keys2 = make_sorted_keys(n, n, 0, 2);
+
+  thrust::host_vector<long long> ref(2 * n), omp(2 * n);
+
+  // every output is written exactly once, so it is tripled exactly once
+  auto ref_end = thrust::set_union(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin());
+  auto omp_end = thrust::set_union(thrust::omp::par, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                                   thrust::make_transform_output_iterator(omp.begin(), times_three()));
+  const int num_union = static_cast<int>(ref_end - ref.begin());
+  ASSERT_EQUAL(omp_end - thrust::make_transform_output_iterator(omp.begin(), times_three()), num_union);
+  for(int i = 0; i < num_union; ++i)
+  {
+    ASSERT_EQUAL(omp[i], 3 * ref[i]);
+  }
+
+  // only counts the output
+  ref_end = thrust::set_symmetric_difference(thrust::seq, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin());
+  auto discarded = thrust::set_symmetric_difference(thrust::omp::par, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                                                    thrust::make_discard_iterator());
+  ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), ref_end - ref.begin());
+}
+DECLARE_UNITTEST(TestOmpSetOperationsToTransformAndDiscardOutput);
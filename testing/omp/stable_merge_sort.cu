@@ -0,0 +1,186 @@
+#include <unittest/unittest.h>
+
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <algorithm>
+#include <cstdint>
+
+// compares only the high bits, so that the low bits, which record the original position,
+// tell equivalent keys apart and the merge sort is used rather than the radix sort
+struct less_high_bits
+{
+  __host__ __device__
+  bool operator()(std::uint64_t x, std::uint64_t y) const
+  {
+    return (x >> 32) < (y >> 32);
+  }
+};
+
+// counts its calls, so that a sort which finds the natural runs can be told from one which doesn't
+struct counted_less_high_bits
+{
+  long long *calls;
+
+  bool operator()(std::uint64_t x, std::uint64_t y) const
+  {
+    ++*calls;
+    return (x >> 32) < (y >> 32);
+  }
+};
+
+
+enum run_pattern
+{
+  presorted_keys,
+  reversed_keys,
+  descending_with_ties,
+  ascending_runs,
+  descending_runs,
+  sawtooth,
+  equal_keys
+};
+
+
+// n keys made of runs of run_length keys in the given pattern, with the original
+// position in their low bits
+thrust::host_vector<std::uint64_t> make_keys(int n, run_pattern pattern, int run_length)
+{
+  thrust::host_vector<std::uint64_t> keys(n);
+
+  std::uint32_t state = 12345;
+
+  for(int i = 0; i < n; ++i)
+  {
+    const int run      = i / run_length;
+    const int position = i % run_length;
+
+    std::uint64_t high = 0;
+
+    switch(pattern)
+    {
+      case presorted_keys:       high = i; break;
+      case reversed_keys:        high = n - i; break;
+      case descending_with_ties: high = (n - i) / 3; break;
+      case ascending_runs:       high = position; break;
+      case descending_runs:      high = run_length - position; break;
+      case sawtooth:             high = run % 2 ? run_length - position : position; break;
+      case equal_keys:           high = 7; break;
+    }
+
+    // every run starts at a random key, so the runs overlap rather than nest
+    if(pattern == ascending_runs || pattern == descending_runs || pattern == sawtooth)
+    {
+      if(position == 0)
+      {
+        state = state * 1664525u + 1013904223u;
+      }
+
+      high += state >> 16;
+    }
+
+    keys[i] = (high << 32) | static_cast<std::uint64_t>(i);
+  }
+
+  return keys;
+}
+
+
+// sorts keys with policy, by themselves and as keys of their positions, and compares
+// the results with std::stable_sort
+template<typename ExecutionPolicy>
+void check_stable_sort(ExecutionPolicy policy, const thrust::host_vector<std::uint64_t> &input)
+{
+  const int n = static_cast<int>(input.size());
+
+  thrust::host_vector<std::uint64_t> ref = input;
+  std::stable_sort(ref.begin(), ref.end(), less_high_bits());
+
+  thrust::host_vector<std::uint64_t> keys = input;
+  thrust::stable_sort(policy, keys.begin(), keys.end(), less_high_bits());
+  ASSERT_EQUAL(keys, ref);
+
+  keys = input;
+  thrust::host_vector<int> values(n);
+  for(int i = 0; i < n; ++i)
+  {
+    values[i] = i;
+  }
+
+  thrust::stable_sort_by_key(policy, keys.begin(), keys.end(), values.begin(), less_high_bits());
+  ASSERT_EQUAL(keys, ref);
+
+  // every value follows the key it started with
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(static_cast<std::uint64_t>(values[i]), keys[i] & 0xffffffffu);
+  }
+}
+
+
+template<typename ExecutionPolicy>
+void check_run_patterns(ExecutionPolicy policy)
+{
+  const int sizes[] = {0, 1, 2, 63, 64, 65, 1000, 100003};
+
+  // run lengths around the shortest run of 32 to 64 keys which isn't extended by insertion sort
+  const int run_lengths[] = {1, 2, 31, 32, 33, 63, 64, 65, 1000};
+
+  for(int n : sizes)
+  {
+    for(run_pattern pattern : {presorted_keys, reversed_keys, descending_with_ties, equal_keys})
+    {
+      check_stable_sort(policy, make_keys(n, pattern, 1));
+    }
+
+    for(int run_length : run_lengths)
+    {
+      for(run_pattern pattern : {ascending_runs, descending_runs, sawtooth})
+      {
+        check_stable_sort(policy, make_keys(n, pattern, run_length));
+      }
+    }
+  }
+}
+
+
+void TestSeqStableMergeSortRuns(void)
+{
+  check_run_patterns(thrust::seq);
+}
+DECLARE_UNITTEST(TestSeqStableMergeSortRuns);
+
+
+void TestSeqStableMergeSortSingleRun(void)
+{
+  const int n = 100003;
+
+  // a presorted or strictly descending input is a single run, found with n - 1 comparisons
+  for(run_pattern pattern : {presorted_keys, reversed_keys})
+  {
+    thrust::host_vector<std::uint64_t> keys = make_keys(n, pattern, 1);
+    thrust::host_vector<std::uint64_t> ref  = keys;
+    std::stable_sort(ref.begin(), ref.end(), less_high_bits());
+
+    long long calls = 0;
+    thrust::stable_sort(thrust::seq, keys.begin(), keys.end(), counted_less_high_bits{&calls});
+    ASSERT_EQUAL(keys, ref);
+    ASSERT_EQUAL(calls, n - 1);
+
+    keys = make_keys(n, pattern, 1);
+    thrust::host_vector<int> values(n, 0);
+
+    calls = 0;
+    thrust::stable_sort_by_key(thrust::seq, keys.begin(), keys.end(), values.begin(), counted_less_high_bits{&calls});
+    ASSERT_EQUAL(keys, ref);
+    ASSERT_EQUAL(calls, n - 1);
+  }
+}
+DECLARE_UNITTEST(TestSeqStableMergeSortSingleRun);
+
+
+void TestOmpStableMergeSortRuns(void)
+{
+  check_run_patterns(thrust::omp::par);
+}
+DECLARE_UNITTEST(TestOmpStableMergeSortRuns);
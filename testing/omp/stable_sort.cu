@@ -0,0 +1,132 @@
+#include <unittest/unittest.h>
+
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <omp.h>
+
+#include <cstdint>
+
+// compares only the high bits, so that a stable sort is distinguishable from an
+// unstable one and the merge sort is used rather than the radix sort
+struct less_high_bits
+{
+  __host__ __device__
+  bool operator()(std::uint32_t x, std::uint32_t y) const
+  {
+    return (x >> 12) < (y >> 12);
+  }
+};
+
+
+enum key_distribution
+{
+  random_keys,
+  equal_keys,
+  few_distinct_keys,
+  presorted_keys,
+  reversed_keys
+};
+
+
+// keys of the given distribution, with distinct low bits recording their original position
+thrust::host_vector<std::uint32_t> make_keys(int n, key_distribution distribution)
+{
+  thrust::host_vector<std::uint32_t> keys(n);
+
+  std::uint32_t state = 12345;
+
+  for(int i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+
+    std::uint32_t high = 0;
+
+    switch(distribution)
+    {
+      case random_keys:       high = state >> 12; break;
+      case equal_keys:        high = 7; break;
+      case few_distinct_keys: high = (state >> 28) % 3; break;
+      case presorted_keys:    high = i / 3; break;
+      case reversed_keys:     high = (n - i) / 3; break;
+    }
+
+    keys[i] = (high << 12) | (i & 0xfff);
+  }
+
+  return keys;
+}
+
+
+const key_distribution distributions[] = {random_keys, equal_keys, few_distinct_keys,
+                                          presorted_keys, reversed_keys};
+
+
+// the merge rounds pair up one tile per thread, so numbers of threads which aren't
+// powers of two leave a tile without a partner in some rounds
+const int num_threads[] = {2, 3, 5, 8};
+
+const int sizes[] = {4097, (1 << 16) + 3, 100003};
+
+
+void TestOmpMergeSortTiles(void)
+{
+  const int max_threads = omp_get_max_threads();
+
+  for(int p : num_threads)
+  {
+    omp_set_num_threads(p);
+
+    for(int n : sizes)
+    {
+      for(key_distribution distribution : distributions)
+      {
+        thrust::host_vector<std::uint32_t> keys = make_keys(n, distribution);
+        thrust::host_vector<std::uint32_t> ref  = keys;
+
+        thrust::stable_sort(thrust::seq, ref.begin(), ref.end(), less_high_bits());
+        thrust::stable_sort(thrust::omp::par, keys.begin(), keys.end(), less_high_bits());
+
+        ASSERT_EQUAL(keys, ref);
+      }
+    }
+  }
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpMergeSortTiles);
+
+
+void TestOmpMergeSortByKeyTiles(void)
+{
+  const int max_threads = omp_get_max_threads();
+
+  for(int p : num_threads)
+  {
+    omp_set_num_threads(p);
+
+    for(int n : sizes)
+    {
+      for(key_distribution distribution : distributions)
+      {
+        thrust::host_vector<std::uint32_t> keys = make_keys(n, distribution);
+        thrust::host_vector<std::uint32_t> ref_keys = keys;
+
+        thrust::host_vector<int> values(n), ref_values(n);
+        for(int i = 0; i < n; ++i)
+        {
+          values[i] = ref_values[i] = i;
+        }
+
+        thrust::stable_sort_by_key(thrust::seq, ref_keys.begin(), ref_keys.end(), ref_values.begin(), less_high_bits());
+        thrust::stable_sort_by_key(thrust::omp::par, keys.begin(), keys.end(), values.begin(), less_high_bits());
+
+        ASSERT_EQUAL(keys, ref_keys);
+        ASSERT_EQUAL(values, ref_values);
+      }
+    }
+  }
+
+  omp_set_num_threads(max_threads);
+}
+DECLARE_UNITTEST(TestOmpMergeSortByKeyTiles);
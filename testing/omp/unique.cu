@@ -0,0 +1,93 @@
+#include <unittest/unittest.h>
+
+#include <thrust/unique.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <vector>
+
+struct equal_div
+{
+  int d;
+
+  __host__ __device__
+  bool operator()(int x, int y) const
+  {
+    return x / d == y / d;
+  }
+};
+
+
+void check_unique(const thrust::host_vector<int> &input)
+{
+  thrust::host_vector<int> ref = input, omp = input;
+
+  auto ref_end = thrust::unique(thrust::seq, ref.begin(), ref.end());
+  auto omp_end = thrust::unique(thrust::omp::par, omp.begin(), omp.end());
+
+  ref.resize(ref_end - ref.begin());
+  omp.resize(omp_end - omp.begin());
+
+  ASSERT_EQUAL(omp, ref);
+}
+
+
+void TestOmpUniqueRunLengths(void)
+{
+  const int sizes[] = {4095, 10001, (1 << 16) + 3, 100003};
+  const int run_lengths[] = {1, 2, 4096, 10000, 1 << 14, 40000, 1 << 20};
+
+  for(int n : sizes)
+  {
+    for(int run_length : run_lengths)
+    {
+      thrust::host_vector<int> input(n);
+      for(int i = 0; i < n; ++i)
+      {
+        input[i] = i / run_length;
+      }
+      check_unique(input);
+    }
+
+    // a single duplicate at the front, so every tile moves by one element
+    thrust::host_vector<int> input(n);
+    for(int i = 0; i < n; ++i)
+    {
+      input[i] = i == 0 ? 0 : i - 1;
+    }
+    check_unique(input);
+
+    // runs of mixed lengths
+    int value = 0;
+    for(int i = 0; i < n; ++value)
+    {
+      const int run_length = 1 + (value * 7919) % 3000;
+      for(int j = 0; j < run_length && i < n; ++j, ++i)
+      {
+        input[i] = value;
+      }
+    }
+    check_unique(input);
+  }
+}
+DECLARE_UNITTEST(TestOmpUniqueRunLengths);
+
+
+void TestOmpUniqueWithPredicate(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<int> ref(n), omp(n);
+  for(int i = 0; i < n; ++i)
+  {
+    ref[i] = omp[i] = i;
+  }
+
+  auto ref_end = thrust::unique(thrust::seq, ref.begin(), ref.end(), equal_div{5000});
+  auto omp_end = thrust::unique(thrust::omp::par, omp.begin(), omp.end(), equal_div{5000});
+
+  ref.resize(ref_end - ref.begin());
+  omp.resize(omp_end - omp.begin());
+
+  ASSERT_EQUAL(omp, ref);
+}
+DECLARE_UNITTEST(TestOmpUniqueWithPredicate);
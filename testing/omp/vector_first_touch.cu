@@ -0,0 +1,180 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/host_vector.h>
+#include <thrust/uninitialized_fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/vector.h>
+
+#include <omp.h>
+
+#include <memory>
+#include <vector>
+
+// records the thread which constructed it
+struct thread_tagged
+{
+  int value;
+  int thread;
+
+  thread_tagged() : value(0), thread(omp_get_thread_num()) {}
+
+  thread_tagged(int value) : value(value), thread(omp_get_thread_num()) {}
+
+  thread_tagged(const thread_tagged &other) : value(other.value), thread(omp_get_thread_num()) {}
+
+  thread_tagged &operator=(const thread_tagged &other)
+  {
+    value  = other.value;
+    thread = omp_get_thread_num();
+    return *this;
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// larger than the threshold of 10000 elements below which the calling thread does all the work
+const int sizes[] = {10001, (1 << 16) + 3, 100003};
+
+
+void TestOmpVectorConstruction(void)
+{
+  for(int n : sizes)
+  {
+    thrust::omp::vector<int> filled(n, 7);
+    ASSERT_EQUAL(filled, thrust::host_vector<int>(n, 7));
+
+    thrust::host_vector<int> ref(thrust::make_counting_iterator(0), thrust::make_counting_iterator(n));
+
+    thrust::omp::vector<int> copied(ref);
+    ASSERT_EQUAL(copied, ref);
+
+    thrust::omp::vector<int> copy_of_copy(copied);
+    ASSERT_EQUAL(copy_of_copy, ref);
+
+    // growing fills the new elements and keeps the old ones
+    thrust::omp::vector<int> grown(copied);
+    grown.resize(2 * n + 1, -1);
+    ASSERT_EQUAL(thrust::host_vector<int>(grown.begin(), grown.begin() + n), ref);
+    ASSERT_EQUAL(thrust::host_vector<int>(grown.begin() + n, grown.end()), thrust::host_vector<int>(n + 1, -1));
+
+    thrust::omp::vector<int> assigned;
+    assigned = ref;
+    ASSERT_EQUAL(assigned, ref);
+
+    assigned.assign(n + 5, 3);
+    ASSERT_EQUAL(assigned, thrust::host_vector<int>(n + 5, 3));
+  }
+}
+DECLARE_UNITTEST(TestOmpVectorConstruction);
+
+
+// the number of times the constructing thread changes along [first, last)
+template<typename Iterator>
+int count_thread_changes(Iterator first, Iterator last)
+{
+  int changes = 0;
+  for(Iterator i = first; i + 1 < last; ++i)
+  {
+    changes += i[0].thread != i[1].thread;
+  }
+  return changes;
+}
+
+
+void TestOmpFillAndCopyTileThreads(void)
+{
+  for(int n : sizes)
+  {
+    std::allocator<thread_tagged> alloc;
+    thread_tagged *filled = alloc.allocate(n);
+
+    thrust::uninitialized_fill_n(thrust::omp::par, filled, n, thread_tagged(5));
+
+    // every tile is constructed by a single thread, and there is at most one tile per processor
+    ASSERT_LESS(count_thread_changes(filled, filled + n), omp_get_num_procs());
+
+    if(omp_get_max_threads() > 1 && omp_get_num_procs() > 1)
+    {
+      // more than one thread takes part
+      ASSERT_LESS(0, count_thread_changes(filled, filled + n));
+    }
+
+    std::vector<thread_tagged> copied(n);
+    thrust::copy(thrust::omp::par, filled, filled + n, copied.begin());
+
+    ASSERT_LESS(count_thread_changes(copied.begin(), copied.end()), omp_get_num_procs());
+
+    // and every element is copied by the thread which constructed it
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(filled[i].value, 5);
+      ASSERT_EQUAL(copied[i].value, 5);
+      ASSERT_EQUAL(copied[i].thread, filled[i].thread);
+    }
+
+    alloc.deallocate(filled, n);
+  }
+}
+DECLARE_UNITTEST(TestOmpFillAndCopyTileThreads);
+
+
+void TestOmpCopyCountingInput(void)
+{
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> result(n);
+
+    auto end = thrust::copy(thrust::omp::par,
+                            thrust::make_counting_iterator<long long>(0),
+                            thrust::make_counting_iterator<long long>(n),
+                            result.begin());
+    ASSERT_EQUAL(end - result.begin(), n);
+
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(result[i], i);
+    }
+
+    auto n_end = thrust::copy_n(thrust::omp::par, thrust::make_counting_iterator<long long>(0), n, result.begin());
+    ASSERT_EQUAL(n_end - result.begin(), n);
+  }
+}
+DECLARE_UNITTEST(TestOmpCopyCountingInput);
+
+
+void TestOmpCopyToTransformAndDiscardOutput(void)
+{
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> result(n);
+
+    // every output is written exactly once, so it is tripled exactly once
+    thrust::copy(thrust::omp::par,
+                 thrust::make_counting_iterator<long long>(0),
+                 thrust::make_counting_iterator<long long>(n),
+                 thrust::make_transform_output_iterator(result.begin(), times_three()));
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(result[i], 3ll * i);
+    }
+
+    auto discarded = thrust::copy(thrust::omp::par,
+                                  thrust::make_counting_iterator<long long>(0),
+                                  thrust::make_counting_iterator<long long>(n),
+                                  thrust::make_discard_iterator());
+    ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), n);
+  }
+}
+DECLARE_UNITTEST(TestOmpCopyToTransformAndDiscardOutput);
@@ -0,0 +1,118 @@
+#include <unittest/unittest.h>
+#include <thrust/sort.h>
+#include <thrust/sequence.h>
+
+#include <algorithm>
+
+using namespace unittest;
+
+typedef unittest::type_list<unittest::uint8_t,
+                            unittest::uint16_t,
+                            unittest::uint32_t,
+                            unittest::uint64_t> UnsignedIntegerTypes;
+
+
+template <typename T>
+struct masked_less
+{
+  T mask;
+
+  masked_less(unsigned int begin_bit, unsigned int end_bit)
+    : mask(0)
+  {
+    for(unsigned int bit = begin_bit; bit < end_bit && bit < 8 * sizeof(T); ++bit)
+      mask |= T(1) << bit;
+  }
+
+  bool operator()(const T &lhs, const T &rhs) const
+  {
+    return (lhs & mask) < (rhs & mask);
+  }
+};
+
+
+// orders indices into keys by the masked keys they point at
+template <typename T>
+struct masked_index_less
+{
+  const thrust::host_vector<T> &keys;
+  masked_less<T> comp;
+
+  masked_index_less(const thrust::host_vector<T> &keys, unsigned int begin_bit, unsigned int end_bit)
+    : keys(keys), comp(begin_bit, end_bit)
+  {}
+
+  bool operator()(unsigned int lhs, unsigned int rhs) const
+  {
+    return comp(keys[lhs], keys[rhs]);
+  }
+};
+
+
+template <typename T>
+struct TestSortBitRange
+{
+  void operator()(const size_t n)
+  {
+    const unsigned int num_bits = 8 * sizeof(T);
+
+    for(unsigned int begin_bit = 0; begin_bit < num_bits; begin_bit += 3)
+    {
+      for(unsigned int end_bit = begin_bit; end_bit <= num_bits; end_bit += 5)
+      {
+        thrust::host_vector<T>   h_keys    = unittest::random_integers<T>(n);
+        thrust::host_vector<T>   reference = h_keys;
+        thrust::device_vector<T> d_keys    = h_keys;
+
+        // the sort is stable, so keys equal in the sorted bits keep their order
+        std::stable_sort(reference.begin(), reference.end(), masked_less<T>(begin_bit, end_bit));
+
+        thrust::sort(h_keys.begin(), h_keys.end(), begin_bit, end_bit);
+        thrust::sort(d_keys.begin(), d_keys.end(), begin_bit, end_bit);
+
+        ASSERT_EQUAL(reference, h_keys);
+        ASSERT_EQUAL(h_keys, d_keys);
+      }
+    }
+  }
+};
+VariableUnitTest<TestSortBitRange, UnsignedIntegerTypes> TestSortBitRangeInstance;
+
+
+template <typename T>
+struct TestSortByKeyBitRange
+{
+  void operator()(const size_t n)
+  {
+    const unsigned int num_bits = 8 * sizeof(T);
+
+    for(unsigned int begin_bit = 0; begin_bit < num_bits; begin_bit += 3)
+    {
+      for(unsigned int end_bit = begin_bit; end_bit <= num_bits; end_bit += 5)
+      {
+        thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+
+        thrust::host_vector<unsigned int> h_values(n);
+        thrust::sequence(h_values.begin(), h_values.end());
+
+        thrust::host_vector<T>            reference_keys   = h_keys;
+        thrust::host_vector<unsigned int> reference_values = h_values;
+        std::stable_sort(reference_values.begin(), reference_values.end(), masked_index_less<T>(h_keys, begin_bit, end_bit));
+        for(size_t i = 0; i < n; i++)
+          reference_keys[i] = h_keys[reference_values[i]];
+
+        thrust::device_vector<T>            d_keys   = h_keys;
+        thrust::device_vector<unsigned int> d_values = h_values;
+
+        thrust::sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), begin_bit, end_bit);
+        thrust::sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), begin_bit, end_bit);
+
+        ASSERT_EQUAL(reference_keys,   h_keys);
+        ASSERT_EQUAL(reference_values, h_values);
+        ASSERT_EQUAL(h_keys,   d_keys);
+        ASSERT_EQUAL(h_values, d_values);
+      }
+    }
+  }
+};
+VariableUnitTest<TestSortByKeyBitRange, UnsignedIntegerTypes> TestSortByKeyBitRangeInstance;
@@ -121,6 +121,24 @@ void TestSortDescendingKeyValue(const size_t n)
 DECLARE_VARIABLE_UNITTEST(TestSortDescendingKeyValue);
 
 
+// sort_by_key need not be stable, so the values of equivalent keys are
+// compared after sorting every run of equal keys by value
+template <typename T>
+void SortValuesOfEqualKeys(const thrust::host_vector<bool>& keys, thrust::host_vector<T>& values)
+{
+    size_t first = 0;
+
+    for(size_t i = 1; i <= keys.size(); ++i)
+    {
+        if(i == keys.size() || keys[i] != keys[first])
+        {
+            thrust::sort(values.begin() + first, values.begin() + i);
+            first = i;
+        }
+    }
+}
+
+
 void TestSortByKeyBool(void)
 {
     const size_t n = 10027;
@@ -135,7 +153,12 @@ void TestSortByKeyBool(void)
     thrust::sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin());
 
     ASSERT_EQUAL(h_keys, d_keys);
-    ASSERT_EQUAL(h_values, d_values);
+
+    thrust::host_vector<int> d_values_h = d_values;
+    SortValuesOfEqualKeys(h_keys, h_values);
+    SortValuesOfEqualKeys(h_keys, d_values_h);
+
+    ASSERT_EQUAL(h_values, d_values_h);
 }
 DECLARE_UNITTEST(TestSortByKeyBool);
 
@@ -154,7 +177,12 @@ void TestSortByKeyBoolDescending(void)
     thrust::sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), thrust::greater<bool>());
 
     ASSERT_EQUAL(h_keys, d_keys);
-    ASSERT_EQUAL(h_values, d_values);
+
+    thrust::host_vector<int> d_values_h = d_values;
+    SortValuesOfEqualKeys(h_keys, h_values);
+    SortValuesOfEqualKeys(h_keys, d_values_h);
+
+    ASSERT_EQUAL(h_values, d_values_h);
 }
 DECLARE_UNITTEST(TestSortByKeyBoolDescending);
 
@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
- *  Modifications Copyright© 2019 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,8 +18,13 @@
 #include <unittest/unittest.h>
 #include <thrust/sort.h>
 #include <thrust/functional.h>
+#include <thrust/execution_policy.h>
+#include <thrust/type_traits/radix_key_decomposer.h>
 #include <thrust/iterator/retag.h>
 
+#include <algorithm>
+#include <vector>
+
 
 template<typename RandomAccessIterator>
 void stable_sort(my_system &system, RandomAccessIterator, RandomAccessIterator)
@@ -190,3 +195,73 @@ void TestStableSortWithIndirection(void)
 }
 DECLARE_INTEGRAL_VECTOR_UNITTEST(TestStableSortWithIndirection);
 
+
+
+struct radix_date
+{
+  short year;
+  unsigned char month;
+  unsigned char day;
+  int id;
+};
+
+__host__ __device__
+bool operator<(const radix_date &lhs, const radix_date &rhs)
+{
+  return thrust::make_tuple(lhs.year, lhs.month, lhs.day) <
+         thrust::make_tuple(rhs.year, rhs.month, rhs.day);
+}
+
+__host__ __device__
+bool operator>(const radix_date &lhs, const radix_date &rhs)
+{
+  return rhs < lhs;
+}
+
+THRUST_NAMESPACE_BEGIN
+template<>
+struct radix_key_decomposer<radix_date>
+{
+  __host__ __device__
+  thrust::tuple<short, unsigned char, unsigned char> operator()(const radix_date &d) const
+  {
+    return thrust::make_tuple(d.year, d.month, d.day);
+  }
+};
+THRUST_NAMESPACE_END
+
+void TestStableSortRadixKeyDecomposer(void)
+{
+  const size_t n = 10027;
+
+  thrust::host_vector<int> random = unittest::random_integers<int>(3 * n);
+
+  std::vector<radix_date> data(n);
+  for(size_t i = 0; i < n; i++)
+  {
+    // few distinct dates, so that the sort has to be stable
+    data[i].year  = static_cast<short>(random[3 * i] % 5 - 2);
+    data[i].month = static_cast<unsigned char>(random[3 * i + 1] % 3);
+    data[i].day   = static_cast<unsigned char>(random[3 * i + 2] % 4);
+    data[i].id    = static_cast<int>(i);
+  }
+
+  ASSERT_EQUAL(thrust::is_radix_key_decomposable<radix_date>::value, true);
+
+  std::vector<radix_date> h_less = data;
+  std::vector<radix_date> ref_less = data;
+  thrust::stable_sort(thrust::host, h_less.begin(), h_less.end(), thrust::less<radix_date>());
+  std::stable_sort(ref_less.begin(), ref_less.end());
+
+  std::vector<radix_date> h_greater = data;
+  std::vector<radix_date> ref_greater = data;
+  thrust::stable_sort(thrust::host, h_greater.begin(), h_greater.end(), thrust::greater<radix_date>());
+  std::stable_sort(ref_greater.begin(), ref_greater.end(), thrust::greater<radix_date>());
+
+  for(size_t i = 0; i < n; i++)
+  {
+    ASSERT_EQUAL(h_less[i].id, ref_less[i].id);
+    ASSERT_EQUAL(h_greater[i].id, ref_greater[i].id);
+  }
+}
+DECLARE_UNITTEST(TestStableSortRadixKeyDecomposer);
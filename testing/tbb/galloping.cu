@@ -0,0 +1,227 @@
+#include <unittest/unittest.h>
+
+#include <thrust/merge.h>
+#include <thrust/set_operations.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <algorithm>
+#include <vector>
+
+// compares only the high bits, so that the low bits tell which input an element came from
+// and equivalent elements of both inputs can be told apart
+struct less_high_bits
+{
+  __host__ __device__
+  bool operator()(long long x, long long y) const
+  {
+    return (x >> 20) < (y >> 20);
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// n sorted keys in [offset, offset + range), each tagged in its low bits with its input and position
+thrust::host_vector<long long> make_sorted_keys(int n, long long range, long long offset, int input)
+{
+  std::vector<long long> keys(n);
+
+  unsigned int state = 12345u + input;
+
+  for(int i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+    keys[i] = offset + (state >> 8) % range;
+  }
+
+  std::sort(keys.begin(), keys.end());
+
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = (keys[i] << 20) | (input << 19) | i;
+  }
+
+  return thrust::host_vector<long long>(keys.begin(), keys.end());
+}
+
+
+// n sorted keys made of runs of run_length consecutive integers, one every period, offset by phase,
+// so that two inputs of different phases interleave in long runs
+thrust::host_vector<long long> make_run_keys(int n, int run_length, long long period, long long phase, int input)
+{
+  thrust::host_vector<long long> keys(n);
+
+  for(int i = 0; i < n; ++i)
+  {
+    const long long key = (i / run_length) * period + phase + i % run_length;
+    keys[i] = (key << 20) | (input << 19) | i;
+  }
+
+  return keys;
+}
+
+
+// checks merge, merge_by_key and every set operation of policy against the standard library
+template<typename ExecutionPolicy>
+void check_against_std(ExecutionPolicy policy,
+                       const thrust::host_vector<long long> &keys1,
+                       const thrust::host_vector<long long> &keys2)
+{
+  const int n = static_cast<int>(keys1.size() + keys2.size());
+
+  std::vector<long long> ref(n);
+  thrust::host_vector<long long> result(n);
+
+  std::vector<long long>::iterator ref_end;
+  thrust::host_vector<long long>::iterator result_end;
+
+  ref_end    = std::merge(keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  result_end = thrust::merge(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result.begin(), less_high_bits());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(thrust::host_vector<long long>(result.begin(), result_end), thrust::host_vector<long long>(ref.begin(), ref_end));
+
+  // the values are the keys themselves
+  thrust::host_vector<long long> values(n);
+  auto ends = thrust::merge_by_key(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(),
+                                   keys1.begin(), keys2.begin(), result.begin(), values.begin(), less_high_bits());
+  ASSERT_EQUAL(ends.first - result.begin(), n);
+  ASSERT_EQUAL(result, thrust::host_vector<long long>(ref.begin(), ref.end()));
+  ASSERT_EQUAL(values, result);
+
+  ref_end    = std::set_union(keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  result_end = thrust::set_union(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result.begin(), less_high_bits());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(thrust::host_vector<long long>(result.begin(), result_end), thrust::host_vector<long long>(ref.begin(), ref_end));
+
+  ref_end    = std::set_intersection(keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  result_end = thrust::set_intersection(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result.begin(), less_high_bits());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(thrust::host_vector<long long>(result.begin(), result_end), thrust::host_vector<long long>(ref.begin(), ref_end));
+
+  ref_end    = std::set_difference(keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  result_end = thrust::set_difference(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result.begin(), less_high_bits());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(thrust::host_vector<long long>(result.begin(), result_end), thrust::host_vector<long long>(ref.begin(), ref_end));
+
+  ref_end    = std::set_symmetric_difference(keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), ref.begin(), less_high_bits());
+  result_end = thrust::set_symmetric_difference(policy, keys1.begin(), keys1.end(), keys2.begin(), keys2.end(), result.begin(), less_high_bits());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(thrust::host_vector<long long>(result.begin(), result_end), thrust::host_vector<long long>(ref.begin(), ref_end));
+}
+
+
+template<typename ExecutionPolicy>
+void check_skewed_inputs(ExecutionPolicy policy)
+{
+  const int n = 100003;
+
+  // sizes on both sides of the skew of 8 at which the merge gallops from the start
+  const int short_sizes[] = {0, 1, 2, 13, n / 9, n / 8, n / 7, n / 2};
+
+  for(int m : short_sizes)
+  {
+    for(long long range : {1ll << 30, 1000ll, 1ll})
+    {
+      check_against_std(policy, make_sorted_keys(n, range, 0, 0), make_sorted_keys(m, range, 0, 1));
+      check_against_std(policy, make_sorted_keys(m, range, 0, 0), make_sorted_keys(n, range, 0, 1));
+    }
+
+    // the short input entirely before, after, or in the middle of the long one
+    check_against_std(policy, make_sorted_keys(n, 1000, 1000, 0), make_sorted_keys(m, 1000, 0,    1));
+    check_against_std(policy, make_sorted_keys(n, 1000, 0,    0), make_sorted_keys(m, 1000, 1000, 1));
+    check_against_std(policy, make_sorted_keys(n, 1000, 0,    0), make_sorted_keys(m, 10,   500,  1));
+  }
+}
+
+
+template<typename ExecutionPolicy>
+void check_run_inputs(ExecutionPolicy policy)
+{
+  const int n = 100003;
+
+  // inputs of similar sizes which alternate in runs shorter than, as long as, and longer than
+  // the run of 7 elements which switches the merge to galloping
+  for(int run_length : {1, 6, 7, 8, 100, 5000})
+  {
+    const long long period = 2 * run_length;
+
+    check_against_std(policy,
+                      make_run_keys(n,     run_length, period, 0,          0),
+                      make_run_keys(n + 3, run_length, period, run_length, 1));
+
+    // runs which overlap by one key, so the inputs have equivalent elements at every switch
+    check_against_std(policy,
+                      make_run_keys(n,     run_length, period, 0,              0),
+                      make_run_keys(n + 3, run_length, period, run_length - 1, 1));
+  }
+}
+
+
+void TestTbbGallopingSkewedInputs(void)
+{
+  check_skewed_inputs(thrust::tbb::par);
+}
+DECLARE_UNITTEST(TestTbbGallopingSkewedInputs);
+
+
+void TestTbbGallopingRunInputs(void)
+{
+  check_run_inputs(thrust::tbb::par);
+}
+DECLARE_UNITTEST(TestTbbGallopingRunInputs);
+
+
+void TestTbbGallopingCountingInput(void)
+{
+  const int n = 100003;
+
+  // a few multiples of three and many naturals, read through iterators which can't be written
+  auto sparse   = thrust::make_transform_iterator(thrust::make_counting_iterator<long long>(0), times_three());
+  auto naturals = thrust::make_counting_iterator<long long>(0);
+
+  const int m = n / 1000;
+
+  std::vector<long long> sparse_keys(m), merged(n + m), ref(n + m);
+  for(int i = 0; i < m; ++i)
+  {
+    sparse_keys[i] = 3 * i;
+  }
+
+  thrust::host_vector<long long> result(n + m);
+
+  std::merge(sparse_keys.begin(), sparse_keys.end(), naturals, naturals + n, merged.begin());
+  auto result_end = thrust::merge(thrust::tbb::par, sparse, sparse + m, naturals, naturals + n, result.begin());
+  ASSERT_EQUAL(result_end - result.begin(), n + m);
+  ASSERT_EQUAL(result, thrust::host_vector<long long>(merged.begin(), merged.end()));
+
+  auto ref_end = std::set_difference(naturals, naturals + n, sparse_keys.begin(), sparse_keys.end(), ref.begin());
+  result_end = thrust::set_difference(thrust::seq, naturals, naturals + n, sparse, sparse + m, result.begin());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  result_end = thrust::set_difference(thrust::tbb::par, naturals, naturals + n, sparse, sparse + m, result.begin());
+  ASSERT_EQUAL(result_end - result.begin(), ref_end - ref.begin());
+  ASSERT_EQUAL(thrust::host_vector<long long>(result.begin(), result_end), thrust::host_vector<long long>(ref.begin(), ref_end));
+
+  // every output is written exactly once, so it is tripled exactly once
+  thrust::merge(thrust::seq, sparse, sparse + m, naturals, naturals + n,
+                thrust::make_transform_output_iterator(result.begin(), times_three()));
+  for(int i = 0; i < n + m; ++i)
+  {
+    ASSERT_EQUAL(result[i], 3 * merged[i]);
+  }
+
+  auto discarded = thrust::set_intersection(thrust::seq, naturals, naturals + n, sparse, sparse + m,
+                                            thrust::make_discard_iterator());
+  ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), m);
+}
+DECLARE_UNITTEST(TestTbbGallopingCountingInput);
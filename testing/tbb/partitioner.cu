@@ -0,0 +1,177 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <tbb/partitioner.h>
+
+#include <algorithm>
+
+struct square_into
+{
+  long long *squares;
+
+  void operator()(int i) const
+  {
+    squares[i] = static_cast<long long>(i) * i;
+  }
+};
+
+struct div_by
+{
+  int d;
+
+  __host__ __device__
+  int operator()(int x) const
+  {
+    return x / d;
+  }
+};
+
+struct is_odd
+{
+  __host__ __device__
+  bool operator()(int x) const
+  {
+    return x % 2 == 1;
+  }
+};
+
+
+// runs for_each, reduce, both scans, sort, reduce_by_key and copy_if with policy,
+// over sizes on both sides of a power of two, and checks their results
+template<typename ExecutionPolicy>
+void check_algorithms(ExecutionPolicy policy)
+{
+  const int sizes[] = {1, 1000, (1 << 16) - 1, (1 << 16) + 1, 100003};
+
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> squares(n, -1);
+    thrust::for_each(policy,
+                     thrust::make_counting_iterator(0), thrust::make_counting_iterator(n),
+                     square_into{thrust::raw_pointer_cast(squares.data())});
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(squares[i], static_cast<long long>(i) * i);
+    }
+
+    long long sum = thrust::reduce(policy,
+                                   thrust::make_counting_iterator<long long>(0),
+                                   thrust::make_counting_iterator<long long>(n));
+    ASSERT_EQUAL(sum, static_cast<long long>(n) * (n - 1) / 2);
+
+    thrust::host_vector<long long> inclusive(n), exclusive(n);
+    thrust::inclusive_scan(policy,
+                           thrust::make_counting_iterator<long long>(0),
+                           thrust::make_counting_iterator<long long>(n),
+                           inclusive.begin());
+    thrust::exclusive_scan(policy,
+                           thrust::make_counting_iterator<long long>(0),
+                           thrust::make_counting_iterator<long long>(n),
+                           exclusive.begin(),
+                           10ll);
+    for(long long i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(inclusive[i], i * (i + 1) / 2);
+      ASSERT_EQUAL(exclusive[i], 10 + i * (i - 1) / 2);
+    }
+
+    thrust::host_vector<int> keys(n);
+    for(int i = 0; i < n; ++i)
+    {
+      keys[i] = n - 1 - i;
+    }
+    thrust::sort(policy, keys.begin(), keys.end());
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(keys[i], i);
+    }
+
+    // segments of 4096 keys, read through a counting_iterator
+    auto segment_keys = thrust::make_transform_iterator(thrust::make_counting_iterator(0), div_by{4096});
+    thrust::host_vector<int> unique_keys(n);
+    thrust::host_vector<long long> segment_sums(n);
+    auto ends = thrust::reduce_by_key(policy,
+                                      segment_keys, segment_keys + n,
+                                      thrust::make_counting_iterator<long long>(0),
+                                      unique_keys.begin(), segment_sums.begin());
+    const int num_segments = (n + 4095) / 4096;
+    ASSERT_EQUAL(ends.first - unique_keys.begin(), num_segments);
+    for(int s = 0; s < num_segments; ++s)
+    {
+      const long long b = 4096ll * s;
+      const long long e = (std::min)(b + 4096, static_cast<long long>(n));
+      ASSERT_EQUAL(unique_keys[s], s);
+      ASSERT_EQUAL(segment_sums[s], (e * (e - 1) - b * (b - 1)) / 2);
+    }
+
+    thrust::host_vector<int> odds(n);
+    auto odds_end = thrust::copy_if(policy,
+                                    thrust::make_counting_iterator(0), thrust::make_counting_iterator(n),
+                                    odds.begin(), is_odd());
+    ASSERT_EQUAL(odds_end - odds.begin(), n / 2);
+    for(int i = 0; i < n / 2; ++i)
+    {
+      ASSERT_EQUAL(odds[i], 2 * i + 1);
+    }
+
+    auto discarded = thrust::copy_if(policy,
+                                     thrust::make_counting_iterator(0), thrust::make_counting_iterator(n),
+                                     thrust::make_discard_iterator(), is_odd());
+    ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), n / 2);
+  }
+}
+
+
+void TestTbbAutoPartitioner(void)
+{
+  check_algorithms(thrust::tbb::par.with(::tbb::auto_partitioner()));
+  check_algorithms(thrust::tbb::par.with(::tbb::auto_partitioner()).grain_size(4096));
+}
+DECLARE_UNITTEST(TestTbbAutoPartitioner);
+
+
+void TestTbbSimplePartitioner(void)
+{
+  // a simple partitioner splits down to the grain size, so keep the number of tasks bounded
+  check_algorithms(thrust::tbb::par.with(::tbb::simple_partitioner()).grain_size(1000));
+  check_algorithms(thrust::tbb::par.grain_size(1 << 14).with(::tbb::simple_partitioner()));
+}
+DECLARE_UNITTEST(TestTbbSimplePartitioner);
+
+
+void TestTbbStaticPartitioner(void)
+{
+  // the scans run with the auto partitioner instead
+  check_algorithms(thrust::tbb::par.with(::tbb::static_partitioner()));
+  check_algorithms(thrust::tbb::par.with(::tbb::static_partitioner()).grain_size(10000));
+}
+DECLARE_UNITTEST(TestTbbStaticPartitioner);
+
+
+void TestTbbAffinityPartitioner(void)
+{
+  ::tbb::affinity_partitioner affinity;
+
+  // the same partitioner replays its chunks across calls, whatever their sizes
+  auto policy = thrust::tbb::par.with(affinity);
+  check_algorithms(policy);
+  check_algorithms(policy);
+  check_algorithms(thrust::tbb::par.grain_size(4096).with(affinity));
+}
+DECLARE_UNITTEST(TestTbbAffinityPartitioner);
+
+
+void TestTbbGrainSizeLargerThanInput(void)
+{
+  check_algorithms(thrust::tbb::par.grain_size(1 << 20));
+}
+DECLARE_UNITTEST(TestTbbGrainSizeLargerThanInput);
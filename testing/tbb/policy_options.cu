@@ -0,0 +1,131 @@
+#include <unittest/unittest.h>
+
+#include <thrust/for_each.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+#include <thrust/sequence.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <memory>
+
+struct record_max_concurrency
+{
+  int *max_concurrencies;
+
+  void operator()(int i) const
+  {
+    max_concurrencies[i] = ::tbb::this_task_arena::max_concurrency();
+  }
+};
+
+
+// runs for_each, reduce, inclusive_scan and sort with policy and checks their results,
+// and that every element of the for_each ran in an arena of the given concurrency
+template<typename ExecutionPolicy>
+void check_algorithms(ExecutionPolicy policy, int expected_max_concurrency)
+{
+  const int n = 1 << 16;
+
+  thrust::host_vector<int> max_concurrencies(n, -1);
+  thrust::for_each(policy,
+                   thrust::make_counting_iterator(0), thrust::make_counting_iterator(n),
+                   record_max_concurrency{thrust::raw_pointer_cast(max_concurrencies.data())});
+  ASSERT_EQUAL(max_concurrencies, thrust::host_vector<int>(n, expected_max_concurrency));
+
+  long long sum = thrust::reduce(policy,
+                                 thrust::make_counting_iterator<long long>(0),
+                                 thrust::make_counting_iterator<long long>(n));
+  ASSERT_EQUAL(sum, static_cast<long long>(n) * (n - 1) / 2);
+
+  thrust::host_vector<long long> scanned(n);
+  thrust::inclusive_scan(policy,
+                         thrust::make_counting_iterator<long long>(0),
+                         thrust::make_counting_iterator<long long>(n),
+                         scanned.begin());
+  for(long long i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(scanned[i], i * (i + 1) / 2);
+  }
+
+  thrust::host_vector<int> keys(n);
+  for(int i = 0; i < n; ++i)
+  {
+    keys[i] = (i * 7919) % n;
+  }
+  thrust::sort(policy, keys.begin(), keys.end());
+  for(int i = 0; i < n; ++i)
+  {
+    ASSERT_EQUAL(keys[i], i);
+  }
+}
+
+
+void TestTbbParOnArena(void)
+{
+  ::tbb::task_arena arena(2);
+
+  check_algorithms(thrust::tbb::par.on(arena), 2);
+}
+DECLARE_UNITTEST(TestTbbParOnArena);
+
+
+void TestTbbParMaxConcurrency(void)
+{
+  const int expected = (std::min)(2, ::tbb::this_task_arena::max_concurrency());
+
+  check_algorithms(thrust::tbb::par.max_concurrency(2), expected);
+
+  // an algorithm called from within a more limited arena stays in it
+  ::tbb::task_arena arena(1);
+  arena.execute([&]
+  {
+    check_algorithms(thrust::tbb::par.max_concurrency(2), 1);
+  });
+}
+DECLARE_UNITTEST(TestTbbParMaxConcurrency);
+
+
+void TestTbbParMaxConcurrencyArenaIsReused(void)
+{
+  auto policy = thrust::tbb::par.max_concurrency(2);
+  auto copy   = policy;
+
+  // get_options is found by argument dependent lookup, as in the algorithms
+
+  const ::tbb::task_arena *arena = get_options(policy).limited_arena.get();
+  ASSERT_EQUAL(arena != 0, true);
+  ASSERT_EQUAL(get_options(copy).limited_arena.get(), arena);
+
+  const int expected = (std::min)(2, ::tbb::this_task_arena::max_concurrency());
+  check_algorithms(policy, expected);
+  check_algorithms(copy, expected);
+
+  ASSERT_EQUAL(get_options(policy).limited_arena.get(), arena);
+}
+DECLARE_UNITTEST(TestTbbParMaxConcurrencyArenaIsReused);
+
+
+void TestTbbParGrainSize(void)
+{
+  check_algorithms(thrust::tbb::par.grain_size(1000), ::tbb::this_task_arena::max_concurrency());
+
+  // a grain size larger than the input runs every loop as a single task
+  check_algorithms(thrust::tbb::par.grain_size(1 << 20), ::tbb::this_task_arena::max_concurrency());
+}
+DECLARE_UNITTEST(TestTbbParGrainSize);
+
+
+void TestTbbParOptionsWithAllocator(void)
+{
+  ::tbb::task_arena arena(2);
+  std::allocator<int> alloc;
+
+  check_algorithms(thrust::tbb::par.on(arena)(alloc), 2);
+  check_algorithms(thrust::tbb::par.on(arena).grain_size(1000)(std::allocator<int>()), 2);
+}
+DECLARE_UNITTEST(TestTbbParOptionsWithAllocator);
@@ -0,0 +1,225 @@
+#include <unittest/unittest.h>
+
+#include <thrust/remove.h>
+#include <thrust/sequence.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+struct is_flagged
+{
+  const int *flags;
+
+  __host__ __device__
+  bool operator()(long long x) const
+  {
+    return flags[x] != 0;
+  }
+};
+
+struct is_multiple_of
+{
+  int d;
+
+  __host__ __device__
+  bool operator()(int x) const
+  {
+    return x % d == 0;
+  }
+};
+
+
+// the bytes of temporary storage in use, and the most that were ever in use at once
+struct allocation_counter
+{
+  std::size_t in_use;
+  std::size_t peak;
+};
+
+
+template<typename T>
+struct counting_allocator : std::allocator<T>
+{
+  typedef T value_type;
+
+  allocation_counter *counter;
+
+  counting_allocator(allocation_counter *counter) : counter(counter) {}
+
+  template<typename U>
+  counting_allocator(const counting_allocator<U> &other) : counter(other.counter) {}
+
+  template<typename U>
+  struct rebind
+  {
+    typedef counting_allocator<U> other;
+  };
+
+  T *allocate(std::size_t n)
+  {
+    counter->in_use += n * sizeof(T);
+    counter->peak = (std::max)(counter->peak, counter->in_use);
+
+    return std::allocator<T>::allocate(n);
+  }
+
+  void deallocate(T *p, std::size_t n)
+  {
+    counter->in_use -= n * sizeof(T);
+
+    std::allocator<T>::deallocate(p, n);
+  }
+};
+
+
+// removes the flagged elements of [0, n) with thrust::tbb::par, with and without a stencil,
+// and compares the result with thrust::seq
+void check_remove_if(const thrust::host_vector<int> &flags)
+{
+  const int n = static_cast<int>(flags.size());
+
+  thrust::host_vector<long long> ref(n), tbb(n), tbb_stencil(n);
+  thrust::sequence(ref.begin(), ref.end());
+  thrust::sequence(tbb.begin(), tbb.end());
+  thrust::sequence(tbb_stencil.begin(), tbb_stencil.end());
+
+  is_flagged pred = {thrust::raw_pointer_cast(flags.data())};
+
+  auto ref_end = thrust::remove_if(thrust::seq, ref.begin(), ref.end(), pred);
+  auto tbb_end = thrust::remove_if(thrust::tbb::par, tbb.begin(), tbb.end(), pred);
+  auto tbb_stencil_end = thrust::remove_if(thrust::tbb::par,
+                                           tbb_stencil.begin(), tbb_stencil.end(),
+                                           flags.begin(),
+                                           thrust::identity<int>());
+
+  ref.resize(ref_end - ref.begin());
+  tbb.resize(tbb_end - tbb.begin());
+  tbb_stencil.resize(tbb_stencil_end - tbb_stencil.begin());
+
+  ASSERT_EQUAL(tbb, ref);
+  ASSERT_EQUAL(tbb_stencil, ref);
+}
+
+
+void TestTbbRemoveIfPatterns(void)
+{
+  const int sizes[] = {4095, 10001, (1 << 16) + 3, 100003};
+
+  for(int n : sizes)
+  {
+    // nothing, everything, and a single element at the front, in the middle and at the back;
+    // removing few elements moves every tile a short distance over the one before it
+    std::vector<thrust::host_vector<int> > patterns(5, thrust::host_vector<int>(n, 0));
+    patterns[1] = thrust::host_vector<int>(n, 1);
+    patterns[2][0] = 1;
+    patterns[3][n / 2] = 1;
+    patterns[4][n - 1] = 1;
+
+    // every other element, all but the last few elements, the front half,
+    // and a block straddling the middle
+    thrust::host_vector<int> flags(n, 0);
+    for(int i = 0; i < n; i += 2) flags[i] = 1;
+    patterns.push_back(flags);
+
+    flags = thrust::host_vector<int>(n, 1);
+    for(int i = n - 10; i < n; ++i) flags[i] = 0;
+    patterns.push_back(flags);
+
+    flags = thrust::host_vector<int>(n, 0);
+    for(int i = 0; i < n / 2; ++i) flags[i] = 1;
+    patterns.push_back(flags);
+
+    flags = thrust::host_vector<int>(n, 0);
+    for(int i = n / 3; i < 2 * n / 3; ++i) flags[i] = 1;
+    patterns.push_back(flags);
+
+    // removing the first few elements of every 4096
+    flags = thrust::host_vector<int>(n, 0);
+    for(int i = 0; i < n; ++i) flags[i] = i % 4096 < 3;
+    patterns.push_back(flags);
+
+    for(const thrust::host_vector<int> &pattern : patterns)
+    {
+      check_remove_if(pattern);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTbbRemoveIfPatterns);
+
+
+void TestTbbRemoveIfCountingStencil(void)
+{
+  const int n = 100003;
+
+  thrust::host_vector<int> ref(n), tbb(n);
+  thrust::sequence(ref.begin(), ref.end());
+  thrust::sequence(tbb.begin(), tbb.end());
+
+  // a stencil which can't be written, removing every seventh element
+  auto stencil = thrust::make_counting_iterator(0);
+
+  auto ref_end = thrust::remove_if(thrust::seq, ref.begin(), ref.end(), stencil, is_multiple_of{7});
+  auto tbb_end = thrust::remove_if(thrust::tbb::par, tbb.begin(), tbb.end(), stencil, is_multiple_of{7});
+
+  ref.resize(ref_end - ref.begin());
+  tbb.resize(tbb_end - tbb.begin());
+
+  ASSERT_EQUAL(tbb, ref);
+}
+DECLARE_UNITTEST(TestTbbRemoveIfCountingStencil);
+
+
+void TestTbbRemoveIfTemporaryStorage(void)
+{
+  // the even tiles keep only their last element and the odd tiles keep everything, so every
+  // odd tile moves almost a whole tile over the element kept before it; the temporary storage
+  // must not grow with the input
+  const int sizes[] = {1 << 18, 1 << 21};
+
+  std::size_t peaks[2];
+
+  for(int s = 0; s < 2; ++s)
+  {
+    const long long n = sizes[s];
+
+    thrust::system::detail::internal::uniform_decomposition<long long> decomp =
+      thrust::system::tbb::detail::default_decomposition(n);
+
+    thrust::host_vector<int> flags(n, 0);
+    for(long long i = 0; i < decomp.size(); i += 2)
+    {
+      for(long long j = decomp[i].begin(); j < decomp[i].end() - 1; ++j)
+      {
+        flags[j] = 1;
+      }
+    }
+
+    thrust::host_vector<long long> ref(n), tbb(n);
+    thrust::sequence(ref.begin(), ref.end());
+    thrust::sequence(tbb.begin(), tbb.end());
+
+    allocation_counter counter = {0, 0};
+    counting_allocator<long long> alloc(&counter);
+
+    is_flagged pred = {thrust::raw_pointer_cast(flags.data())};
+
+    auto ref_end = thrust::remove_if(thrust::seq, ref.begin(), ref.end(), pred);
+    auto tbb_end = thrust::remove_if(thrust::tbb::par(alloc), tbb.begin(), tbb.end(), pred);
+
+    ref.resize(ref_end - ref.begin());
+    tbb.resize(tbb_end - tbb.begin());
+
+    ASSERT_EQUAL(tbb, ref);
+    ASSERT_EQUAL(counter.in_use, 0u);
+
+    peaks[s] = counter.peak;
+  }
+
+  ASSERT_EQUAL(peaks[0], peaks[1]);
+}
+DECLARE_UNITTEST(TestTbbRemoveIfTemporaryStorage);
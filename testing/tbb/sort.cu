@@ -0,0 +1,104 @@
+#include <unittest/unittest.h>
+
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+
+#include <cstdint>
+
+// compares only the high bits, so that a stable sort is distinguishable from an
+// unstable one and the sample sort is used rather than the radix sort
+struct less_high_bits
+{
+  __host__ __device__
+  bool operator()(std::uint32_t x, std::uint32_t y) const
+  {
+    return (x >> 12) < (y >> 12);
+  }
+};
+
+
+enum key_distribution
+{
+  random_keys,
+  equal_keys,
+  few_distinct_keys,
+  one_dominant_key,
+  presorted_keys,
+  reversed_keys
+};
+
+
+// keys of the given distribution, with distinct low bits recording their original position
+thrust::host_vector<std::uint32_t> make_keys(int n, key_distribution distribution)
+{
+  thrust::host_vector<std::uint32_t> keys(n);
+
+  std::uint32_t state = 12345;
+
+  for(int i = 0; i < n; ++i)
+  {
+    state = state * 1664525u + 1013904223u;
+
+    std::uint32_t high = 0;
+
+    switch(distribution)
+    {
+      case random_keys:       high = state >> 12; break;
+      case equal_keys:        high = 7; break;
+      case few_distinct_keys: high = (state >> 28) % 3; break;
+      case one_dominant_key:  high = (state >> 24) < 243 ? 42 : state >> 12; break;
+      case presorted_keys:    high = i / 3; break;
+      case reversed_keys:     high = (n - i) / 3; break;
+    }
+
+    keys[i] = (high << 12) | (i & 0xfff);
+  }
+
+  return keys;
+}
+
+
+// larger than the sample sort threshold of 1 << 20, and not a multiple of the number of tiles
+const int sample_sort_size = (1 << 20) + 12345;
+
+const key_distribution distributions[] = {random_keys, equal_keys, few_distinct_keys,
+                                          one_dominant_key, presorted_keys, reversed_keys};
+
+
+void TestTbbSampleSortDistributions(void)
+{
+  for(key_distribution distribution : distributions)
+  {
+    thrust::host_vector<std::uint32_t> keys = make_keys(sample_sort_size, distribution);
+    thrust::host_vector<std::uint32_t> ref  = keys;
+
+    thrust::stable_sort(thrust::seq, ref.begin(), ref.end(), less_high_bits());
+    thrust::stable_sort(thrust::tbb::par, keys.begin(), keys.end(), less_high_bits());
+
+    ASSERT_EQUAL(keys, ref);
+  }
+}
+DECLARE_UNITTEST(TestTbbSampleSortDistributions);
+
+
+void TestTbbSampleSortByKeyDistributions(void)
+{
+  for(key_distribution distribution : distributions)
+  {
+    thrust::host_vector<std::uint32_t> keys = make_keys(sample_sort_size, distribution);
+    thrust::host_vector<std::uint32_t> ref_keys = keys;
+
+    thrust::host_vector<int> values(sample_sort_size), ref_values(sample_sort_size);
+    for(int i = 0; i < sample_sort_size; ++i)
+    {
+      values[i] = ref_values[i] = i;
+    }
+
+    thrust::stable_sort_by_key(thrust::seq, ref_keys.begin(), ref_keys.end(), ref_values.begin(), less_high_bits());
+    thrust::stable_sort_by_key(thrust::tbb::par, keys.begin(), keys.end(), values.begin(), less_high_bits());
+
+    ASSERT_EQUAL(keys, ref_keys);
+    ASSERT_EQUAL(values, ref_values);
+  }
+}
+DECLARE_UNITTEST(TestTbbSampleSortByKeyDistributions);
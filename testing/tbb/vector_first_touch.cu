@@ -0,0 +1,174 @@
+#include <unittest/unittest.h>
+
+#include <thrust/copy.h>
+#include <thrust/host_vector.h>
+#include <thrust/uninitialized_fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/vector.h>
+
+#include <tbb/task_arena.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+// records the thread which constructed it
+struct thread_tagged
+{
+  int value;
+  int thread;
+
+  thread_tagged() : value(0), thread(::tbb::this_task_arena::current_thread_index()) {}
+
+  thread_tagged(int value) : value(value), thread(::tbb::this_task_arena::current_thread_index()) {}
+
+  thread_tagged(const thread_tagged &other) : value(other.value), thread(::tbb::this_task_arena::current_thread_index()) {}
+
+  thread_tagged &operator=(const thread_tagged &other)
+  {
+    value  = other.value;
+    thread = ::tbb::this_task_arena::current_thread_index();
+    return *this;
+  }
+};
+
+struct times_three
+{
+  __host__ __device__
+  long long operator()(long long x) const
+  {
+    return 3 * x;
+  }
+};
+
+
+// larger than the threshold of 10000 elements below which the calling thread does all the work
+const int sizes[] = {10001, (1 << 16) + 3, 100003};
+
+
+void TestTbbVectorConstruction(void)
+{
+  for(int n : sizes)
+  {
+    thrust::tbb::vector<int> filled(n, 7);
+    ASSERT_EQUAL(filled, thrust::host_vector<int>(n, 7));
+
+    thrust::host_vector<int> ref(thrust::make_counting_iterator(0), thrust::make_counting_iterator(n));
+
+    thrust::tbb::vector<int> copied(ref);
+    ASSERT_EQUAL(copied, ref);
+
+    thrust::tbb::vector<int> copy_of_copy(copied);
+    ASSERT_EQUAL(copy_of_copy, ref);
+
+    // growing fills the new elements and keeps the old ones
+    thrust::tbb::vector<int> grown(copied);
+    grown.resize(2 * n + 1, -1);
+    ASSERT_EQUAL(thrust::host_vector<int>(grown.begin(), grown.begin() + n), ref);
+    ASSERT_EQUAL(thrust::host_vector<int>(grown.begin() + n, grown.end()), thrust::host_vector<int>(n + 1, -1));
+
+    thrust::tbb::vector<int> assigned;
+    assigned = ref;
+    ASSERT_EQUAL(assigned, ref);
+
+    assigned.assign(n + 5, 3);
+    ASSERT_EQUAL(assigned, thrust::host_vector<int>(n + 5, 3));
+  }
+}
+DECLARE_UNITTEST(TestTbbVectorConstruction);
+
+
+// the number of times the constructing thread changes along [first, last)
+template<typename Iterator>
+int count_thread_changes(Iterator first, Iterator last)
+{
+  int changes = 0;
+  for(Iterator i = first; i + 1 < last; ++i)
+  {
+    changes += i[0].thread != i[1].thread;
+  }
+  return changes;
+}
+
+
+void TestTbbFillAndCopyTileThreads(void)
+{
+  for(int n : sizes)
+  {
+    std::allocator<thread_tagged> alloc;
+    thread_tagged *filled = alloc.allocate(n);
+
+    thrust::uninitialized_fill_n(thrust::tbb::par, filled, n, thread_tagged(5));
+
+    // every tile is constructed by a single thread, and there is at most one tile per processor
+    const int num_procs = static_cast<int>(std::thread::hardware_concurrency());
+    ASSERT_LESS(count_thread_changes(filled, filled + n), num_procs);
+
+    std::vector<thread_tagged> copied(n);
+    thrust::copy(thrust::tbb::par, filled, filled + n, copied.begin());
+
+    ASSERT_LESS(count_thread_changes(copied.begin(), copied.end()), num_procs);
+
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(filled[i].value, 5);
+      ASSERT_EQUAL(copied[i].value, 5);
+    }
+
+    alloc.deallocate(filled, n);
+  }
+}
+DECLARE_UNITTEST(TestTbbFillAndCopyTileThreads);
+
+
+void TestTbbCopyCountingInput(void)
+{
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> result(n);
+
+    auto end = thrust::copy(thrust::tbb::par,
+                            thrust::make_counting_iterator<long long>(0),
+                            thrust::make_counting_iterator<long long>(n),
+                            result.begin());
+    ASSERT_EQUAL(end - result.begin(), n);
+
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(result[i], i);
+    }
+
+    auto n_end = thrust::copy_n(thrust::tbb::par, thrust::make_counting_iterator<long long>(0), n, result.begin());
+    ASSERT_EQUAL(n_end - result.begin(), n);
+  }
+}
+DECLARE_UNITTEST(TestTbbCopyCountingInput);
+
+
+void TestTbbCopyToTransformAndDiscardOutput(void)
+{
+  for(int n : sizes)
+  {
+    thrust::host_vector<long long> result(n);
+
+    // every output is written exactly once, so it is tripled exactly once
+    thrust::copy(thrust::tbb::par,
+                 thrust::make_counting_iterator<long long>(0),
+                 thrust::make_counting_iterator<long long>(n),
+                 thrust::make_transform_output_iterator(result.begin(), times_three()));
+    for(int i = 0; i < n; ++i)
+    {
+      ASSERT_EQUAL(result[i], 3ll * i);
+    }
+
+    auto discarded = thrust::copy(thrust::tbb::par,
+                                  thrust::make_counting_iterator<long long>(0),
+                                  thrust::make_counting_iterator<long long>(n),
+                                  thrust::make_discard_iterator());
+    ASSERT_EQUAL(discarded - thrust::make_discard_iterator(), n);
+  }
+}
+DECLARE_UNITTEST(TestTbbCopyToTransformAndDiscardOutput);
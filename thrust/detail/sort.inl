@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -53,6 +54,20 @@ __host__ __device__
 } // end sort()
 
 
+__thrust_exec_check_disable__
+template<typename DerivedPolicy, typename RandomAccessIterator>
+__host__ __device__
+  void sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            unsigned int begin_bit,
+            unsigned int end_bit)
+{
+  using thrust::system::detail::generic::sort;
+  return sort(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, begin_bit, end_bit);
+} // end sort()
+
+
 __thrust_exec_check_disable__
 template<typename DerivedPolicy, typename RandomAccessIterator>
 __host__ __device__
@@ -112,6 +127,23 @@ __host__ __device__
 } // end sort_by_key()
 
 
+__thrust_exec_check_disable__
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit)
+{
+  using thrust::system::detail::generic::sort_by_key;
+  return sort_by_key(thrust::detail::derived_cast(thrust::detail::strip_const(exec)), keys_first, keys_last, values_first, begin_bit, end_bit);
+} // end sort_by_key()
+
+
 __thrust_exec_check_disable__
 template<typename DerivedPolicy,
          typename RandomAccessIterator1,
@@ -229,6 +261,22 @@ template<typename RandomAccessIterator,
 } // end sort()
 
 
+template<typename RandomAccessIterator>
+  void sort(RandomAccessIterator first,
+            RandomAccessIterator last,
+            unsigned int begin_bit,
+            unsigned int end_bit)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator>::type System;
+
+  System system;
+
+  return thrust::sort(select_system(system), first, last, begin_bit, end_bit);
+} // end sort()
+
+
 template<typename RandomAccessIterator>
   void stable_sort(RandomAccessIterator first,
                    RandomAccessIterator last)
@@ -302,6 +350,26 @@ template<typename RandomAccessIterator1,
 } // end sort_by_key()
 
 
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void sort_by_key(RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit)
+{
+  using thrust::system::detail::generic::select_system;
+
+  typedef typename thrust::iterator_system<RandomAccessIterator1>::type System1;
+  typedef typename thrust::iterator_system<RandomAccessIterator2>::type System2;
+
+  System1 system1;
+  System2 system2;
+
+  return thrust::sort_by_key(select_system(system1,system2), keys_first, keys_last, values_first, begin_bit, end_bit);
+} // end sort_by_key()
+
+
 template<typename RandomAccessIterator1,
          typename RandomAccessIterator2>
   void stable_sort_by_key(RandomAccessIterator1 keys_first,
@@ -0,0 +1,485 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A pooling memory resource adaptor meant to be shared by many threads, which locks every block size
+ *  separately and serves most requests from per-thread magazines of free blocks.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <thrust/detail/algorithm_wrapper.h>
+#include <thrust/detail/integer_math.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/pool_options.h>
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A pooling memory resource adaptor that can be used from many threads at once, without the single lock of
+ *      \p synchronized_pool_resource.
+ *
+ *  Blocks of every size (a power of two between \p pool_options::smallest_block_size and
+ *      \p pool_options::largest_block_size) are pooled separately, each pool guarded by its own mutex, so threads only
+ *      contend when they allocate blocks of the same size. On top of that, every thread owns a magazine of up to
+ *      \p pool_options::magazine_size free blocks of every size. Allocations are served from the magazine, which is
+ *      refilled with half its capacity of blocks at once when it runs empty; deallocations go to the magazine, which
+ *      returns half of its blocks to the shared pool at once when it runs full. The pools are only locked once per
+ *      batch, and a block freed by a thread is likely to be reused by the same thread while it is still in its cache.
+ *
+ *  Magazines are assigned to threads in the order in which the threads first use any concurrent pool; when there
+ *      are more threads than magazines (the hardware concurrency, rounded up to a power of two), some threads share
+ *      a magazine. Each magazine is guarded by its own mutex, which is therefore normally uncontended.
+ *
+ *  Oversized and overaligned requests are forwarded to an \p unsynchronized_pool_resource guarded by a mutex of its
+ *      own, and are cached according to the same options as in that pool.
+ *
+ *  Like \p unsynchronized_pool_resource, this resource embeds the bookkeeping of the pools in the memory allocated
+ *      from \p Upstream. Uses \p std::mutex and \p thread_local, and therefore requires C++11.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template<typename Upstream>
+class concurrent_pool_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+    typedef unsynchronized_pool_resource<Upstream> oversized_pool;
+    typedef std::lock_guard<std::mutex> lock_t;
+
+    typedef typename Upstream::pointer void_ptr;
+
+public:
+    /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+     *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+     *      just a slight departure from the defaults is easy.
+     */
+    static pool_options get_default_options()
+    {
+        pool_options ret = oversized_pool::get_default_options();
+
+        ret.magazine_size = 16;
+
+        return ret;
+    }
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param options pool options to use
+     */
+    concurrent_pool_resource(Upstream * upstream, pool_options options = get_default_options())
+        : m_upstream(upstream),
+        m_options(options),
+        m_smallest_block_log2(thrust::detail::log2_ri(m_options.smallest_block_size)),
+        m_num_buckets(thrust::detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1),
+        m_buckets(new bucket[m_num_buckets]),
+        m_num_magazines(default_magazine_count()),
+        m_magazines(new magazine[m_num_magazines]),
+        m_oversized(upstream, options)
+    {
+        assert(m_options.validate());
+
+        init();
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param options pool options to use
+     */
+    concurrent_pool_resource(pool_options options = get_default_options())
+        : m_upstream(get_global_resource<Upstream>()),
+        m_options(options),
+        m_smallest_block_log2(thrust::detail::log2_ri(m_options.smallest_block_size)),
+        m_num_buckets(thrust::detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1),
+        m_buckets(new bucket[m_num_buckets]),
+        m_num_magazines(default_magazine_count()),
+        m_magazines(new magazine[m_num_magazines]),
+        m_oversized(get_global_resource<Upstream>(), options)
+    {
+        assert(m_options.validate());
+
+        init();
+    }
+
+    /*! Destructor. Releases all held memory to upstream.
+     */
+    ~concurrent_pool_resource()
+    {
+        release();
+    }
+
+    /*! Releases all held memory to upstream. Must not be called while other threads use the pool.
+     */
+    void release()
+    {
+        for (std::size_t i = 0; i < m_num_magazines; ++i)
+        {
+            lock_t lock(m_magazines[i].mtx);
+            std::fill(m_magazines[i].counts.begin(), m_magazines[i].counts.end(), 0);
+        }
+
+        for (std::size_t i = 0; i < m_num_buckets; ++i)
+        {
+            bucket & b = m_buckets[i];
+            lock_t lock(b.mtx);
+
+            while (detail::pointer_traits<chunk_descriptor_ptr>::get(b.chunks))
+            {
+                chunk_descriptor_ptr alloc = b.chunks;
+                chunk_descriptor desc = *alloc;
+                b.chunks = desc.next;
+
+                void_ptr p = static_cast<void_ptr>(
+                    static_cast<char_ptr>(
+                        static_cast<void_ptr>(alloc)
+                    ) - desc.size
+                );
+                m_upstream->do_deallocate(p, desc.size + sizeof(chunk_descriptor), m_options.alignment);
+            }
+
+            b.free_list = block_descriptor_ptr();
+            b.previous_allocated_count = 0;
+        }
+
+        lock_t lock(m_oversized_mtx);
+        m_oversized.release();
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        bytes = (std::max)(bytes, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            lock_t lock(m_oversized_mtx);
+            return m_oversized.do_allocate(bytes, alignment);
+        }
+
+        std::size_t bucket_idx = thrust::detail::log2_ri(bytes) - m_smallest_block_log2;
+
+        if (m_options.magazine_size == 0)
+        {
+            void_ptr ret;
+            take_blocks(bucket_idx, &ret, 1);
+            return ret;
+        }
+
+        magazine & mag = this_thread_magazine();
+        lock_t lock(mag.mtx);
+
+        std::size_t & count = mag.counts[bucket_idx];
+        void_ptr * blocks = &mag.blocks[bucket_idx * m_options.magazine_size];
+
+        // refill an empty magazine with half of its capacity at once
+        if (count == 0)
+        {
+            count = take_blocks(bucket_idx, blocks, (m_options.magazine_size + 1) / 2);
+        }
+
+        return blocks[--count];
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        n = (std::max)(n, m_options.smallest_block_size);
+        assert(detail::is_power_of_2(alignment));
+
+        // verify that the pointer is at least as aligned as claimed
+        assert(reinterpret_cast<detail::intmax_t>(detail::pointer_traits<void_ptr>::get(p)) % alignment == 0);
+
+        if (n > m_options.largest_block_size || alignment > m_options.alignment)
+        {
+            lock_t lock(m_oversized_mtx);
+            m_oversized.do_deallocate(p, n, alignment);
+            return;
+        }
+
+        std::size_t bucket_idx = thrust::detail::log2_ri(n) - m_smallest_block_log2;
+
+        if (m_options.magazine_size == 0)
+        {
+            return_blocks(bucket_idx, &p, 1);
+            return;
+        }
+
+        magazine & mag = this_thread_magazine();
+        lock_t lock(mag.mtx);
+
+        std::size_t & count = mag.counts[bucket_idx];
+        void_ptr * blocks = &mag.blocks[bucket_idx * m_options.magazine_size];
+
+        // return the least recently freed half of a full magazine to the pool at once,
+        // keeping the blocks most likely to still be in the cache of this thread
+        if (count == m_options.magazine_size)
+        {
+            std::size_t flushed = count / 2;
+            return_blocks(bucket_idx, blocks, flushed);
+            std::copy(blocks + flushed, blocks + count, blocks);
+            count -= flushed;
+        }
+
+        blocks[count++] = p;
+    }
+
+private:
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other char_ptr;
+
+    struct block_descriptor;
+    struct chunk_descriptor;
+
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<block_descriptor>::other block_descriptor_ptr;
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<chunk_descriptor>::other chunk_descriptor_ptr;
+
+    struct block_descriptor
+    {
+        block_descriptor_ptr next;
+    };
+
+    struct chunk_descriptor
+    {
+        std::size_t size;
+        chunk_descriptor_ptr next;
+    };
+
+    // the padding keeps the data of neighbouring buckets and magazines, which
+    // are locked by different threads, from sharing a cache line
+    static const std::size_t cache_line_size = 64;
+
+    struct bucket_data
+    {
+        std::mutex mtx;
+        block_descriptor_ptr free_list;
+        chunk_descriptor_ptr chunks;
+        std::size_t previous_allocated_count;
+    };
+
+    struct bucket : bucket_data
+    {
+        char padding[2 * cache_line_size - sizeof(bucket_data) % cache_line_size];
+    };
+
+    struct magazine_data
+    {
+        std::mutex mtx;
+        std::vector<std::size_t> counts;
+        std::vector<void_ptr> blocks;
+    };
+
+    struct magazine : magazine_data
+    {
+        char padding[2 * cache_line_size - sizeof(magazine_data) % cache_line_size];
+    };
+
+    Upstream * m_upstream;
+
+    pool_options m_options;
+    std::size_t m_smallest_block_log2;
+
+    std::size_t m_num_buckets;
+    std::unique_ptr<bucket[]> m_buckets;
+
+    std::size_t m_num_magazines;
+    std::unique_ptr<magazine[]> m_magazines;
+
+    std::mutex m_oversized_mtx;
+    oversized_pool m_oversized;
+
+    static std::size_t default_magazine_count()
+    {
+        std::size_t threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+        return static_cast<std::size_t>(1) << thrust::detail::log2_ri(threads);
+    }
+
+    // a number unique to the calling thread, assigned when it first uses any pool of this type
+    static std::size_t thread_index()
+    {
+        static std::atomic<std::size_t> next_index(0);
+        static thread_local std::size_t index = next_index++;
+        return index;
+    }
+
+    void init()
+    {
+        for (std::size_t i = 0; i < m_num_buckets; ++i)
+        {
+            m_buckets[i].free_list = block_descriptor_ptr();
+            m_buckets[i].chunks = chunk_descriptor_ptr();
+            m_buckets[i].previous_allocated_count = 0;
+        }
+
+        for (std::size_t i = 0; i < m_num_magazines; ++i)
+        {
+            m_magazines[i].counts.resize(m_num_buckets, 0);
+            m_magazines[i].blocks.resize(m_num_buckets * m_options.magazine_size);
+        }
+    }
+
+    magazine & this_thread_magazine()
+    {
+        return m_magazines[thread_index() & (m_num_magazines - 1)];
+    }
+
+    // takes n blocks from the pool of the bucket, allocating a new chunk from
+    // upstream if the pool runs empty first; returns the number of blocks taken
+    std::size_t take_blocks(std::size_t bucket_idx, void_ptr * blocks, std::size_t n)
+    {
+        bucket & b = m_buckets[bucket_idx];
+        lock_t lock(b.mtx);
+
+        std::size_t bytes_log2 = bucket_idx + m_smallest_block_log2;
+        std::size_t bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (!detail::pointer_traits<block_descriptor_ptr>::get(b.free_list))
+            {
+                // the blocks already taken are enough for now
+                if (i != 0)
+                {
+                    return i;
+                }
+
+                allocate_chunk(b, bytes_log2);
+            }
+
+            block_descriptor_ptr block = b.free_list;
+            b.free_list = thrust::raw_reference_cast(*block).next;
+            blocks[i] = static_cast<void_ptr>(
+                static_cast<char_ptr>(
+                    static_cast<void_ptr>(block)
+                ) - bytes
+            );
+        }
+
+        return n;
+    }
+
+    // pushes n blocks to the front of the pool of the bucket
+    void return_blocks(std::size_t bucket_idx, const void_ptr * blocks, std::size_t n)
+    {
+        bucket & b = m_buckets[bucket_idx];
+        lock_t lock(b.mtx);
+
+        std::size_t bytes = static_cast<std::size_t>(1) << (bucket_idx + m_smallest_block_log2);
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
+                static_cast<void_ptr>(
+                    static_cast<char_ptr>(blocks[i]) + bytes
+                )
+            );
+
+            block_descriptor desc;
+            desc.next = b.free_list;
+            *block = desc;
+            b.free_list = block;
+        }
+    }
+
+    // allocates a chunk from upstream and splits it into blocks pushed to the free list
+    // of the bucket, growing the chunks of a bucket like unsynchronized_pool_resource does
+    void allocate_chunk(bucket & b, std::size_t bytes_log2)
+    {
+        std::size_t bytes = static_cast<std::size_t>(1) << bytes_log2;
+
+        std::size_t n = b.previous_allocated_count;
+        if (n == 0)
+        {
+            n = m_options.min_blocks_per_chunk;
+            if (n < (m_options.min_bytes_per_chunk >> bytes_log2))
+            {
+                n = m_options.min_bytes_per_chunk >> bytes_log2;
+            }
+        }
+        else
+        {
+            n = n * 3 / 2;
+            if (n > (m_options.max_bytes_per_chunk >> bytes_log2))
+            {
+                n = m_options.max_bytes_per_chunk >> bytes_log2;
+            }
+            if (n > m_options.max_blocks_per_chunk)
+            {
+                n = m_options.max_blocks_per_chunk;
+            }
+        }
+        b.previous_allocated_count = n;
+
+        std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+        std::size_t block_size = bytes + descriptor_size;
+        block_size += m_options.alignment - block_size % m_options.alignment;
+        std::size_t chunk_size = block_size * n;
+
+        void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+        chunk_descriptor_ptr chunk = static_cast<chunk_descriptor_ptr>(
+            static_cast<void_ptr>(
+                static_cast<char_ptr>(allocated) + chunk_size
+            )
+        );
+
+        chunk_descriptor chunk_desc;
+        chunk_desc.size = chunk_size;
+        chunk_desc.next = b.chunks;
+        *chunk = chunk_desc;
+        b.chunks = chunk;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            block_descriptor_ptr block = static_cast<block_descriptor_ptr>(
+                static_cast<void_ptr>(
+                    static_cast<char_ptr>(allocated) + block_size * i + bytes
+                )
+            );
+
+            block_descriptor block_desc;
+            block_desc.next = b.free_list;
+            *block = block_desc;
+            b.free_list = block;
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -26,11 +27,13 @@
 
 #include <thrust/host_vector.h>
 #include <thrust/binary_search.h>
+#include <thrust/sort.h>
 #include <thrust/detail/seq.h>
 
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_statistics.h>
 
 #include <cassert>
 
@@ -64,13 +67,18 @@ namespace mr
  *      both the upstream and the bookkeeper are of the same type, to allocate memory consistently, but separately for
  *      those two purposes.
  *
+ *  The pool collects statistics about its use if \p Statistics is \p pool_statistics, which \p statistics then
+ *      returns; \p disjoint_unsynchronized_pool_resource is this pool without statistics, which don't cost anything then.
+ *
  *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks to be handed off to the user
  *  \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ *  \tparam Statistics the statistics policy of the pool; \p no_pool_statistics or \p pool_statistics
  */
-template<typename Upstream, typename Bookkeeper>
-class disjoint_unsynchronized_pool_resource final
+template<typename Upstream, typename Bookkeeper, typename Statistics>
+class basic_disjoint_unsynchronized_pool_resource
     : public memory_resource<typename Upstream::pointer>,
-        private validator2<Upstream, Bookkeeper>
+        private validator2<Upstream, Bookkeeper>,
+        private Statistics
 {
 public:
     /*! Get the default options for a disjoint pool. These are meant to be a sensible set of values for many use cases,
@@ -96,6 +104,10 @@ public:
         ret.cached_size_cutoff_factor = 16;
         ret.cached_alignment_cutoff_factor = 16;
 
+        ret.max_cached_bytes = 0;
+
+        ret.magazine_size = 0;
+
         return ret;
     }
 
@@ -105,7 +117,7 @@ public:
      *  \param bookkeeper the upstream memory resource for bookkeeping
      *  \param options pool options to use
      */
-    disjoint_unsynchronized_pool_resource(Upstream * upstream, Bookkeeper * bookkeeper,
+    basic_disjoint_unsynchronized_pool_resource(Upstream * upstream, Bookkeeper * bookkeeper,
         pool_options options = get_default_options())
         : m_upstream(upstream),
         m_bookkeeper(bookkeeper),
@@ -114,13 +126,17 @@ public:
         m_pools(m_bookkeeper),
         m_allocated(m_bookkeeper),
         m_cached_oversized(m_bookkeeper),
-        m_oversized(m_bookkeeper)
+        m_oversized(m_bookkeeper),
+        m_cached_bytes(0),
+        m_cache_clock(0)
     {
         assert(m_options.validate());
 
         pointer_vector free(m_bookkeeper);
         pool p(free);
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        Statistics::on_construct(m_pools.size(), m_options.smallest_block_size);
     }
 
     // TODO: C++11: use delegating constructors
@@ -129,7 +145,7 @@ public:
      *
      *  \param options pool options to use
      */
-    disjoint_unsynchronized_pool_resource(pool_options options = get_default_options())
+    basic_disjoint_unsynchronized_pool_resource(pool_options options = get_default_options())
         : m_upstream(get_global_resource<Upstream>()),
         m_bookkeeper(get_global_resource<Bookkeeper>()),
         m_options(options),
@@ -137,18 +153,22 @@ public:
         m_pools(m_bookkeeper),
         m_allocated(m_bookkeeper),
         m_cached_oversized(m_bookkeeper),
-        m_oversized(m_bookkeeper)
+        m_oversized(m_bookkeeper),
+        m_cached_bytes(0),
+        m_cache_clock(0)
     {
         assert(m_options.validate());
 
         pointer_vector free(m_bookkeeper);
         pool p(free);
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        Statistics::on_construct(m_pools.size(), m_options.smallest_block_size);
     }
 
     /*! Destructor. Releases all held memory to upstream.
      */
-    ~disjoint_unsynchronized_pool_resource()
+    ~basic_disjoint_unsynchronized_pool_resource()
     {
         release();
     }
@@ -168,11 +188,28 @@ private:
         allocator<chunk_descriptor, Bookkeeper>
     > chunk_vector;
 
+    // orders chunks by address
+    struct chunk_address_less
+    {
+        __host__ __device__
+        bool operator()(const chunk_descriptor & lhs, const chunk_descriptor & rhs) const
+        {
+            return detail::pointer_traits<void_ptr>::get(lhs.pointer) < detail::pointer_traits<void_ptr>::get(rhs.pointer);
+        }
+    };
+
+    typedef thrust::host_vector<
+        std::size_t,
+        allocator<std::size_t, Bookkeeper>
+    > size_vector;
+
     struct oversized_block_descriptor
     {
         std::size_t size;
         std::size_t alignment;
         void_ptr pointer;
+        // when the block was last returned to the cache; orders the cached blocks for eviction
+        std::size_t cached_at;
 
         __host__ __device__
         bool operator==(const oversized_block_descriptor & other) const
@@ -279,6 +316,64 @@ private:
     oversized_block_vector m_cached_oversized;
     // list of all oversized/overaligned allocations from upstream
     oversized_block_vector m_oversized;
+    // the total size of the cached oversized/overaligned blocks
+    std::size_t m_cached_bytes;
+    // counts the blocks returned to the cache
+    std::size_t m_cache_clock;
+
+    void_ptr allocate_upstream(std::size_t bytes, std::size_t alignment)
+    {
+        void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+        Statistics::on_upstream_allocate(bytes);
+        return ret;
+    }
+
+    void deallocate_upstream(void_ptr p, std::size_t bytes, std::size_t alignment)
+    {
+        m_upstream->do_deallocate(p, bytes, alignment);
+        Statistics::on_upstream_deallocate(bytes);
+    }
+
+    // returns the least recently cached oversized/overaligned block to upstream
+    void evict_cached()
+    {
+        typename oversized_block_vector::iterator oldest = m_cached_oversized.begin();
+        for (typename oversized_block_vector::iterator it = oldest + 1; it != m_cached_oversized.end(); ++it)
+        {
+            if ((*it).cached_at < (*oldest).cached_at)
+            {
+                oldest = it;
+            }
+        }
+
+        oversized_block_descriptor oversized = *oldest;
+        m_cached_oversized.erase(oldest);
+        m_cached_bytes -= oversized.size;
+
+        typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(oversized.pointer));
+        assert(it != m_oversized.end());
+        m_oversized.erase(it);
+
+        deallocate_upstream(oversized.pointer, oversized.size, oversized.alignment);
+    }
+
+    // returns the index of the chunk containing p, if the chunks are ordered by address
+    std::size_t containing_chunk(void_ptr p) const
+    {
+        chunk_descriptor probe;
+        probe.size = 0;
+        probe.pointer = p;
+
+        typename chunk_vector::const_iterator it = thrust::upper_bound(
+            thrust::seq,
+            m_allocated.begin(),
+            m_allocated.end(),
+            probe,
+            chunk_address_less());
+        assert(it != m_allocated.begin());
+
+        return (it - m_allocated.begin()) - 1;
+    }
 
 public:
     /*! Releases all held memory to upstream.
@@ -295,7 +390,7 @@ public:
         // deallocate memory allocated for the buckets
         for (std::size_t i = 0; i < m_allocated.size(); ++i)
         {
-            m_upstream->do_deallocate(
+            deallocate_upstream(
                 m_allocated[i].pointer,
                 m_allocated[i].size,
                 m_options.alignment);
@@ -304,7 +399,7 @@ public:
         // deallocate cached oversized/overaligned memory
         for (std::size_t i = 0; i < m_oversized.size(); ++i)
         {
-            m_upstream->do_deallocate(
+            deallocate_upstream(
                 m_oversized[i].pointer,
                 m_oversized[i].size,
                 m_oversized[i].alignment);
@@ -313,6 +408,91 @@ public:
         m_allocated.clear();
         m_oversized.clear();
         m_cached_oversized.clear();
+        m_cached_bytes = 0;
+
+        Statistics::on_release();
+    }
+
+    /*! Returns a snapshot of the statistics collected by the pool. Only available if \p Statistics is
+     *      \p pool_statistics.
+     */
+    pool_statistics_snapshot statistics() const
+    {
+        return Statistics::snapshot();
+    }
+
+    /*! Releases the memory of chunks none of whose blocks are allocated, and of all cached oversized and overaligned
+     *      blocks, to upstream. Unlike \p release, leaves the memory that is in use intact, and can therefore be called
+     *      at any time to return the memory left idle after a peak in use.
+     */
+    void trim()
+    {
+        thrust::sort(thrust::seq, m_allocated.begin(), m_allocated.end(), chunk_address_less());
+
+        // count the bytes of every chunk taken by the free blocks in it
+        size_vector free_bytes(m_bookkeeper);
+        free_bytes.resize(m_allocated.size(), 0);
+
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            std::size_t bucket_size = static_cast<std::size_t>(1) << (i + m_smallest_block_log2);
+            pointer_vector & free_blocks = m_pools[i].free_blocks;
+
+            for (std::size_t j = 0; j < free_blocks.size(); ++j)
+            {
+                free_bytes[containing_chunk(free_blocks[j])] += bucket_size;
+            }
+        }
+
+        // drop the blocks of the chunks that are entirely free from the free lists, keeping the order of the others
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            pointer_vector & free_blocks = m_pools[i].free_blocks;
+
+            std::size_t kept = 0;
+            for (std::size_t j = 0; j < free_blocks.size(); ++j)
+            {
+                std::size_t chunk = containing_chunk(free_blocks[j]);
+                if (free_bytes[chunk] != m_allocated[chunk].size)
+                {
+                    free_blocks[kept++] = free_blocks[j];
+                }
+            }
+            Statistics::on_blocks_trimmed(i, free_blocks.size() - kept);
+            free_blocks.erase(free_blocks.begin() + kept, free_blocks.end());
+        }
+
+        // return the chunks that are entirely free to upstream
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < m_allocated.size(); ++i)
+        {
+            chunk_descriptor chunk = m_allocated[i];
+            if (free_bytes[i] == chunk.size)
+            {
+                deallocate_upstream(chunk.pointer, chunk.size, m_options.alignment);
+                Statistics::on_chunk_deallocate();
+            }
+            else
+            {
+                m_allocated[kept++] = chunk;
+            }
+        }
+        m_allocated.erase(m_allocated.begin() + kept, m_allocated.end());
+
+        // return the cached oversized/overaligned memory to upstream
+        for (std::size_t i = 0; i < m_cached_oversized.size(); ++i)
+        {
+            oversized_block_descriptor oversized = m_cached_oversized[i];
+
+            typename oversized_block_vector::iterator it = find_if(m_oversized.begin(), m_oversized.end(), equal_pointers(oversized.pointer));
+            assert(it != m_oversized.end());
+            m_oversized.erase(it);
+
+            deallocate_upstream(oversized.pointer, oversized.size, oversized.alignment);
+        }
+
+        m_cached_oversized.clear();
+        m_cached_bytes = 0;
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -367,15 +547,20 @@ public:
                 if (it != m_cached_oversized.end())
                 {
                     oversized.pointer = (*it).pointer;
+                    m_cached_bytes -= (*it).size;
                     m_cached_oversized.erase(it);
+
+                    Statistics::on_oversized_allocate(bytes, true);
                     return oversized.pointer;
                 }
             }
 
             // no fitting cached block found; allocate a new one that's just up to the specs
-            oversized.pointer = m_upstream->do_allocate(bytes, alignment);
+            oversized.pointer = allocate_upstream(bytes, alignment);
+            oversized.cached_at = 0;
             m_oversized.push_back(oversized);
 
+            Statistics::on_oversized_allocate(bytes, false);
             return oversized.pointer;
         }
 
@@ -422,7 +607,7 @@ public:
 
             chunk_descriptor allocated;
             allocated.size = bytes;
-            allocated.pointer = m_upstream->do_allocate(bytes, m_options.alignment);
+            allocated.pointer = allocate_upstream(bytes, m_options.alignment);
             m_allocated.push_back(allocated);
             bucket.previous_allocated_count = n;
 
@@ -434,11 +619,14 @@ public:
                     )
                 );
             }
+
+            Statistics::on_chunk_allocate(bucket_idx, n);
         }
 
         // allocate a block from the front of the bucket's free list
         void_ptr ret = bucket.free_blocks.back();
         bucket.free_blocks.pop_back();
+        Statistics::on_block_allocate(bucket_idx);
         return ret;
     }
 
@@ -458,16 +646,30 @@ public:
 
             oversized_block_descriptor oversized = *it;
 
-            if (m_options.cache_oversized)
+            Statistics::on_oversized_deallocate(n);
+
+            // blocks larger than the whole cache go straight back to upstream
+            if (m_options.cache_oversized
+                && (m_options.max_cached_bytes == 0 || oversized.size <= m_options.max_cached_bytes))
             {
+                oversized.cached_at = m_cache_clock++;
+
                 typename oversized_block_vector::iterator position = lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
                 m_cached_oversized.insert(position, oversized);
+                m_cached_bytes += oversized.size;
+
+                // return the least recently cached blocks to upstream while the cache is over its limit
+                while (m_options.max_cached_bytes != 0 && m_cached_bytes > m_options.max_cached_bytes)
+                {
+                    evict_cached();
+                }
+
                 return;
             }
 
             m_oversized.erase(it);
 
-            m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+            deallocate_upstream(p, oversized.size, oversized.alignment);
 
             return;
         }
@@ -478,6 +680,44 @@ public:
         pool & bucket = m_pools[bucket_idx];
 
         bucket.free_blocks.push_back(p);
+
+        Statistics::on_block_deallocate(bucket_idx);
+    }
+};
+
+/*! A memory resource adaptor allowing for pooling and caching allocations from \p Upstream, using \p Bookkeeper for
+ *      management of that cached and pooled memory, allowing to cache portions of memory inaccessible from the host. See
+ *      \p basic_disjoint_unsynchronized_pool_resource, of which this is the version that collects no statistics.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks to be handed off to the user
+ *  \tparam Bookkeeper the type of memory resources that will be used for allocating bookkeeping memory
+ */
+template<typename Upstream, typename Bookkeeper>
+class disjoint_unsynchronized_pool_resource final
+    : public basic_disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper, no_pool_statistics>
+{
+    typedef basic_disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper, no_pool_statistics> base;
+
+public:
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param bookkeeper the upstream memory resource for bookkeeping
+     *  \param options pool options to use
+     */
+    disjoint_unsynchronized_pool_resource(Upstream * upstream, Bookkeeper * bookkeeper,
+        pool_options options = base::get_default_options())
+        : base(upstream, bookkeeper, options)
+    {
+    }
+
+    /*! Constructor. Upstream and bookkeeping resources are obtained by calling \p get_global_resource for their types.
+     *
+     *  \param options pool options to use
+     */
+    disjoint_unsynchronized_pool_resource(pool_options options = base::get_default_options())
+        : base(options)
+    {
     }
 };
 
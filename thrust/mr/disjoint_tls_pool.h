@@ -1,5 +1,6 @@
 /*
  *  Copyright 2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -15,7 +16,7 @@
  */
 
 /*! \file disjoint_tls_pool.h
- *  \brief A function wrapping a thread local instance of a \p disjoint_unsynchronized_pool_resource.
+ *  \brief Functions wrapping a thread local instance of a \p disjoint_unsynchronized_pool_resource.
  */
 
 #pragma once
@@ -26,6 +27,7 @@
 #if THRUST_CPP_DIALECT >= 2011
 
 #include <thrust/mr/disjoint_pool.h>
+#include <thrust/mr/tls_pool_resource.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -59,6 +61,32 @@ thrust::mr::disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper> & tls_di
     return adaptor;
 }
 
+/*! Potentially constructs, if not yet created, and then returns the address of a thread-local
+ *      \p disjoint_unsynchronized_pool_resource owned by a \p tls_pool_resource, which lets other threads
+ *      deallocate the blocks allocated from it. The pool is distinct from the one returned by \p tls_disjoint_pool.
+ *
+ *  \tparam Upstream the first template argument to the pool template
+ *  \tparam Bookkeeper the second template argument to the pool template
+ *  \param upstream the first argument to the constructor, if invoked
+ *  \param bookkeeper the second argument to the constructor, if invoked
+ */
+template<typename Upstream, typename Bookkeeper>
+__host__
+thrust::mr::tls_pool_resource<thrust::mr::disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper> > &
+tls_disjoint_pool_with_remote_frees(
+    Upstream * upstream = NULL,
+    Bookkeeper * bookkeeper = NULL)
+{
+    static thread_local thrust::mr::tls_pool_resource<
+        thrust::mr::disjoint_unsynchronized_pool_resource<Upstream, Bookkeeper>
+    > adaptor([&]{
+        assert(upstream && bookkeeper);
+        return upstream;
+    }(), bookkeeper);
+
+    return adaptor;
+}
+
 /*! \}
  */
 
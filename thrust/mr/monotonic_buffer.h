@@ -0,0 +1,254 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A memory resource adaptor which hands out memory by bumping a pointer through a buffer, and only frees it
+ *  all at once.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/algorithm_wrapper.h>
+
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cstddef>
+#include <limits>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor which allocates memory by advancing a pointer through a buffer, and which doesn't free
+ *      any memory until it is released or destroyed.
+ *
+ *  The first buffer is either provided by the caller, or allocated from \p Upstream on the first allocation. When the
+ *      current buffer cannot fit an allocation, a new buffer, twice as large as the previous one or as large as the
+ *      allocation, whichever is larger, is allocated from \p Upstream; the rest of the previous buffer is left unused.
+ *      \p do_deallocate does nothing, and \p release returns all buffers allocated from \p Upstream at once, after
+ *      which allocations start over from the beginning of the buffer provided by the caller.
+ *
+ *  This makes allocation and deallocation nearly free, at the cost of never reusing memory before \p release. It suits
+ *      short-lived allocations with a known upper bound on their total size, such as the temporary storage of the
+ *      algorithms: with \p thrust::mr::allocator over this resource passed to an execution policy, e.g.
+ *      <tt>thrust::cpp::par(alloc)</tt>, all temporary storage of a sequence of algorithm calls costs a single upstream
+ *      allocation, if the initial size is large enough, and is freed with one call to \p release.
+ *
+ *  The bookkeeping of the buffers allocated from \p Upstream is kept at their ends, as in
+ *      \p unsynchronized_pool_resource, so it is only touched when a buffer is allocated or released. Like the
+ *      unsynchronized pools, this resource is not thread safe.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating buffers
+ */
+template<typename Upstream>
+class monotonic_buffer_resource final
+    : public memory_resource<typename Upstream::pointer>,
+        private validator<Upstream>
+{
+    typedef typename Upstream::pointer void_ptr;
+
+public:
+    /*! The size of the first buffer allocated from upstream, unless another one is given to the constructor.
+     */
+    static const std::size_t default_initial_size = static_cast<std::size_t>(1) << 12;
+
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for buffers
+     *  \param initial_size the size of the first buffer allocated from \p upstream
+     */
+    explicit monotonic_buffer_resource(Upstream * upstream, std::size_t initial_size = default_initial_size)
+        : m_upstream(upstream),
+        m_initial_buffer(),
+        m_initial_buffer_size(0),
+        m_initial_next_size(initial_size != 0 ? initial_size : 1),
+        m_current(),
+        m_space(0),
+        m_next_size(m_initial_next_size),
+        m_allocated()
+    {
+    }
+
+    /*! Constructor. Allocations are made from \p buffer until it is exhausted, and only then from \p upstream.
+     *      \p buffer is never deallocated by the resource.
+     *
+     *  \param upstream the upstream memory resource for buffers
+     *  \param buffer the first buffer to allocate memory from
+     *  \param buffer_size the size of \p buffer
+     */
+    monotonic_buffer_resource(Upstream * upstream, void_ptr buffer, std::size_t buffer_size)
+        : m_upstream(upstream),
+        m_initial_buffer(buffer),
+        m_initial_buffer_size(buffer_size),
+        m_initial_next_size(buffer_size > default_initial_size / 2 ? buffer_size * 2 : default_initial_size),
+        m_current(static_cast<char_ptr>(buffer)),
+        m_space(buffer_size),
+        m_next_size(m_initial_next_size),
+        m_allocated()
+    {
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param initial_size the size of the first buffer allocated from upstream
+     */
+    explicit monotonic_buffer_resource(std::size_t initial_size = default_initial_size)
+        : m_upstream(get_global_resource<Upstream>()),
+        m_initial_buffer(),
+        m_initial_buffer_size(0),
+        m_initial_next_size(initial_size != 0 ? initial_size : 1),
+        m_current(),
+        m_space(0),
+        m_next_size(m_initial_next_size),
+        m_allocated()
+    {
+    }
+
+    /*! Destructor. Releases all buffers allocated from upstream.
+     */
+    ~monotonic_buffer_resource()
+    {
+        release();
+    }
+
+    /*! Returns all buffers allocated from upstream, and makes subsequent allocations start over from the beginning of
+     *      the buffer provided to the constructor, if any. All memory allocated from this resource becomes invalid.
+     */
+    void release()
+    {
+        while (detail::pointer_traits<buffer_descriptor_ptr>::get(m_allocated))
+        {
+            buffer_descriptor_ptr alloc = m_allocated;
+            buffer_descriptor desc = *alloc;
+            m_allocated = desc.next;
+
+            void_ptr p = static_cast<void_ptr>(
+                static_cast<char_ptr>(
+                    static_cast<void_ptr>(alloc)
+                ) - desc.size
+            );
+            m_upstream->do_deallocate(p, desc.size + sizeof(buffer_descriptor), desc.alignment);
+        }
+
+        m_current = static_cast<char_ptr>(m_initial_buffer);
+        m_space = m_initial_buffer_size;
+        m_next_size = m_initial_next_size;
+    }
+
+    /*! Returns the upstream memory resource of this resource.
+     */
+    Upstream * upstream_resource() const
+    {
+        return m_upstream;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        std::size_t padding = padding_for(m_current, alignment);
+
+        if (!detail::pointer_traits<char_ptr>::get(m_current) || bytes > m_space || padding > m_space - bytes)
+        {
+            allocate_buffer(bytes, alignment);
+            padding = 0;
+        }
+
+        char_ptr ret = m_current + padding;
+        m_current = ret + bytes;
+        m_space -= padding + bytes;
+
+        return static_cast<void_ptr>(ret);
+    }
+
+    // memory is only freed by release
+    virtual void do_deallocate(void_ptr, std::size_t, std::size_t) override
+    {
+    }
+
+private:
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<char>::other char_ptr;
+
+    struct buffer_descriptor;
+    typedef typename thrust::detail::pointer_traits<void_ptr>::template rebind<buffer_descriptor>::other buffer_descriptor_ptr;
+
+    // follows every buffer allocated from upstream
+    struct buffer_descriptor
+    {
+        std::size_t size;
+        std::size_t alignment;
+        buffer_descriptor_ptr next;
+    };
+
+    Upstream * m_upstream;
+
+    void_ptr m_initial_buffer;
+    std::size_t m_initial_buffer_size;
+    std::size_t m_initial_next_size;
+
+    char_ptr m_current;
+    std::size_t m_space;
+    std::size_t m_next_size;
+
+    buffer_descriptor_ptr m_allocated;
+
+    static std::size_t padding_for(char_ptr p, std::size_t alignment)
+    {
+        std::size_t address = reinterpret_cast<std::size_t>(detail::pointer_traits<char_ptr>::get(p));
+        return (alignment - address % alignment) % alignment;
+    }
+
+    // allocates a buffer from upstream that can fit an allocation of the given size and alignment
+    // at its beginning, and makes it the current buffer
+    void allocate_buffer(std::size_t bytes, std::size_t alignment)
+    {
+        std::size_t size = (std::max)(m_next_size, bytes);
+
+        // keep the descriptor aligned
+        size = (size + THRUST_MR_DEFAULT_ALIGNMENT - 1) / THRUST_MR_DEFAULT_ALIGNMENT * THRUST_MR_DEFAULT_ALIGNMENT;
+        alignment = (std::max)(alignment, static_cast<std::size_t>(THRUST_MR_DEFAULT_ALIGNMENT));
+
+        void_ptr allocated = m_upstream->do_allocate(size + sizeof(buffer_descriptor), alignment);
+        buffer_descriptor_ptr buffer = static_cast<buffer_descriptor_ptr>(
+            static_cast<void_ptr>(
+                static_cast<char_ptr>(allocated) + size
+            )
+        );
+
+        buffer_descriptor desc;
+        desc.size = size;
+        desc.alignment = alignment;
+        desc.next = m_allocated;
+        *buffer = desc;
+        m_allocated = buffer;
+
+        m_current = static_cast<char_ptr>(allocated);
+        m_space = size;
+        m_next_size = size <= (std::numeric_limits<std::size_t>::max)() / 2 ? size * 2 : size;
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -31,8 +32,11 @@
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/pool_statistics.h>
 
 #include <cassert>
+#include <cstdint>
+#include <vector>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -57,17 +61,29 @@ namespace mr
  *      than the \p disjoint_unsynchronized_pool_resource, because it doesn't need to allocate additional blocks of memory
  *      from a separate resource, which in turn would necessitate the bookkeeping overhead in the upstream resource.
  *
+ *  Cached oversized and overaligned blocks are indexed by size class, with eight classes per power of two, so finding
+ *      the best fitting cached block takes a constant number of steps regardless of how many blocks are cached (unless
+ *      blocks of the same size class are cached with many different alignments). When \p cache_oversized is set, those
+ *      blocks are allocated from upstream rounded up to the next size class boundary, which wastes at most an eighth of
+ *      their size. \p pool_options::max_cached_bytes caps the memory held by the cache; the least recently cached
+ *      blocks are returned to upstream first.
+ *
  *  This version requires that memory allocated from Upstream is accessible from device. It supports smart references,
  *      meaning that the non-managed CUDA resource, returning a device-tagged pointer, will work, but will be much less
  *      efficient than the disjoint version, which wouldn't need to touch device memory at all, and therefore wouldn't need
  *      to transfer it back and forth between the host and the device whenever an allocation or a deallocation happens.
  *
+ *  The pool collects statistics about its use if \p Statistics is \p pool_statistics, which \p statistics then
+ *      returns; \p unsynchronized_pool_resource is this pool without statistics, which don't cost anything then.
+ *
  *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ *  \tparam Statistics the statistics policy of the pool; \p no_pool_statistics or \p pool_statistics
  */
-template<typename Upstream>
-class unsynchronized_pool_resource final
+template<typename Upstream, typename Statistics>
+class basic_unsynchronized_pool_resource
     : public memory_resource<typename Upstream::pointer>,
-        private validator<Upstream>
+        private validator<Upstream>,
+        private Statistics
 {
 public:
     /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
@@ -93,6 +109,10 @@ public:
         ret.cached_size_cutoff_factor = 16;
         ret.cached_alignment_cutoff_factor = 16;
 
+        ret.max_cached_bytes = 0;
+
+        ret.magazine_size = 0;
+
         return ret;
     }
 
@@ -101,19 +121,25 @@ public:
      *  \param upstream the upstream memory resource for allocations
      *  \param options pool options to use
      */
-    unsynchronized_pool_resource(Upstream * upstream, pool_options options = get_default_options())
+    basic_unsynchronized_pool_resource(Upstream * upstream, pool_options options = get_default_options())
         : m_upstream(upstream),
         m_options(options),
         m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
         m_pools(upstream),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_cached_classes(),
+        m_cached_class_mask(),
+        m_cached_newest(),
+        m_cached_oldest(),
+        m_cached_bytes(0)
     {
         assert(m_options.validate());
 
         pool p = { block_descriptor_ptr(), 0 };
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        Statistics::on_construct(m_pools.size(), m_options.smallest_block_size);
     }
 
     // TODO: C++11: use delegating constructors
@@ -122,24 +148,30 @@ public:
      *
      *  \param options pool options to use
      */
-    unsynchronized_pool_resource(pool_options options = get_default_options())
+    basic_unsynchronized_pool_resource(pool_options options = get_default_options())
         : m_upstream(get_global_resource<Upstream>()),
         m_options(options),
         m_smallest_block_log2(detail::log2_ri(m_options.smallest_block_size)),
         m_pools(get_global_resource<Upstream>()),
         m_allocated(),
         m_oversized(),
-        m_cached_oversized()
+        m_cached_classes(),
+        m_cached_class_mask(),
+        m_cached_newest(),
+        m_cached_oldest(),
+        m_cached_bytes(0)
     {
         assert(m_options.validate());
 
         pool p = { block_descriptor_ptr(), 0 };
         m_pools.resize(detail::log2_ri(m_options.largest_block_size) - m_smallest_block_log2 + 1, p);
+
+        Statistics::on_construct(m_pools.size(), m_options.smallest_block_size);
     }
 
     /*! Destructor. Releases all held memory to upstream.
      */
-    ~unsynchronized_pool_resource()
+    ~basic_unsynchronized_pool_resource()
     {
         release();
     }
@@ -167,25 +199,26 @@ private:
         chunk_descriptor_ptr next;
     };
 
-    // this was originally a forward list, but I made it a doubly linked list
-    // because that way deallocation when not caching is faster and doesn't require
-    // traversal of a linked list (it's still a forward list for the cached list,
-    // because allocation from that list already traverses)
-    //
-    // TODO: investigate whether it's better to have this be a doubly-linked list
-    // with fast do_deallocate when !m_options.cache_oversized, or to have this be
-    // a forward list and require traversal in do_deallocate
-    //
-    // I assume that it is better this way, but the additional pointer could
-    // potentially hurt? these are supposed to be oversized and/or overaligned,
-    // so they are kinda memory intensive already
+    // oversized and overaligned blocks are allocated directly from upstream, and are followed
+    // by this descriptor; all of them are kept in a doubly linked list, so that a block can
+    // be returned to upstream without traversing anything, and the cached ones are also
+    // linked into the list of their size class and into a list ordered by recency of use
     struct oversized_block_descriptor
     {
+        // the size of the current (or last) allocation from the block, which the
+        // descriptor immediately follows
         std::size_t size;
+        // the size of the block allocated from upstream, not counting the descriptor
+        std::size_t capacity;
         std::size_t alignment;
         oversized_block_descriptor_ptr prev;
         oversized_block_descriptor_ptr next;
+        // neighbors in the list of cached blocks of the same size class
+        oversized_block_descriptor_ptr prev_cached;
         oversized_block_descriptor_ptr next_cached;
+        // neighbors in the list of cached blocks, from the most to the least recently cached
+        oversized_block_descriptor_ptr newer;
+        oversized_block_descriptor_ptr older;
     };
 
     struct pool
@@ -199,6 +232,13 @@ private:
         allocator<pool, Upstream>
     > pool_vector;
 
+    // cached blocks are indexed by size class; the classes split every power of two into
+    // 2^size_class_bits classes, and sizes below 2^size_class_bits have a class each
+    static const std::size_t size_class_bits = 3;
+    static const std::size_t size_classes_per_power = static_cast<std::size_t>(1) << size_class_bits;
+    static const std::size_t num_size_classes = (8 * sizeof(std::size_t) - size_class_bits + 1) * size_classes_per_power;
+    static const std::size_t num_size_class_words = (num_size_classes + 63) / 64;
+
     Upstream * m_upstream;
 
     pool_options m_options;
@@ -207,7 +247,285 @@ private:
     pool_vector m_pools;
     chunk_descriptor_ptr m_allocated;
     oversized_block_descriptor_ptr m_oversized;
-    oversized_block_descriptor_ptr m_cached_oversized;
+
+    // the first cached block of each size class, and a bit per size class which is set if it has any
+    oversized_block_descriptor_ptr m_cached_classes[num_size_classes];
+    std::uint64_t m_cached_class_mask[num_size_class_words];
+    oversized_block_descriptor_ptr m_cached_newest;
+    oversized_block_descriptor_ptr m_cached_oldest;
+    std::size_t m_cached_bytes;
+
+    // returns the size class of blocks of the given size
+    static std::size_t size_class(std::size_t size)
+    {
+        if (size < size_classes_per_power)
+        {
+            return size;
+        }
+
+        std::size_t size_log2 = thrust::detail::log2(size);
+        std::size_t minor = (size >> (size_log2 - size_class_bits)) & (size_classes_per_power - 1);
+
+        return (size_log2 - size_class_bits + 1) * size_classes_per_power + minor;
+    }
+
+    // rounds size up to the smallest size of its size class or a larger one
+    static std::size_t round_to_size_class(std::size_t size)
+    {
+        if (size < size_classes_per_power)
+        {
+            return size;
+        }
+
+        std::size_t step = static_cast<std::size_t>(1) << (thrust::detail::log2(size) - size_class_bits);
+        std::size_t rounded = (size + step - 1) & ~(step - 1);
+
+        // don't round past the largest representable size
+        return rounded < size ? size : rounded;
+    }
+
+    // returns the first size class starting at first which has cached blocks, or num_size_classes
+    std::size_t find_cached_class(std::size_t first) const
+    {
+        for (std::size_t word = first / 64; word < num_size_class_words; ++word)
+        {
+            std::uint64_t bits = m_cached_class_mask[word];
+            if (word == first / 64)
+            {
+                bits &= ~static_cast<std::uint64_t>(0) << (first % 64);
+            }
+
+            if (bits)
+            {
+                // the index of the lowest set bit
+                return word * 64 + thrust::detail::log2(bits & (~bits + 1));
+            }
+        }
+
+        return num_size_classes;
+    }
+
+    static void_ptr block_start(oversized_block_descriptor_ptr block, std::size_t size)
+    {
+        return static_cast<void_ptr>(
+            static_cast<char_ptr>(
+                static_cast<void_ptr>(block)
+            ) - size
+        );
+    }
+
+    static oversized_block_descriptor_ptr descriptor_of(void_ptr p, std::size_t size)
+    {
+        return static_cast<oversized_block_descriptor_ptr>(
+            static_cast<void_ptr>(
+                static_cast<char_ptr>(p) + size
+            )
+        );
+    }
+
+    // links a block returned by the user into its size class and as the most recently cached block
+    void push_cached(oversized_block_descriptor_ptr block)
+    {
+        oversized_block_descriptor desc = *block;
+        std::size_t cls = size_class(desc.capacity);
+        oversized_block_descriptor_ptr & head = m_cached_classes[cls];
+
+        desc.prev_cached = oversized_block_descriptor_ptr();
+        desc.next_cached = head;
+        desc.newer = oversized_block_descriptor_ptr();
+        desc.older = m_cached_newest;
+        *block = desc;
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next_cached))
+        {
+            oversized_block_descriptor next = *desc.next_cached;
+            next.prev_cached = block;
+            *desc.next_cached = next;
+        }
+        head = block;
+        m_cached_class_mask[cls / 64] |= static_cast<std::uint64_t>(1) << (cls % 64);
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.older))
+        {
+            oversized_block_descriptor older = *desc.older;
+            older.newer = block;
+            *desc.older = older;
+        }
+        else
+        {
+            m_cached_oldest = block;
+        }
+        m_cached_newest = block;
+
+        m_cached_bytes += desc.capacity;
+    }
+
+    // unlinks a block from its size class and from the recency list
+    void erase_cached(oversized_block_descriptor_ptr block)
+    {
+        oversized_block_descriptor desc = *block;
+        std::size_t cls = size_class(desc.capacity);
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.prev_cached))
+        {
+            oversized_block_descriptor prev = *desc.prev_cached;
+            prev.next_cached = desc.next_cached;
+            *desc.prev_cached = prev;
+        }
+        else
+        {
+            assert(m_cached_classes[cls] == block);
+            m_cached_classes[cls] = desc.next_cached;
+            if (!detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next_cached))
+            {
+                m_cached_class_mask[cls / 64] &= ~(static_cast<std::uint64_t>(1) << (cls % 64));
+            }
+        }
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next_cached))
+        {
+            oversized_block_descriptor next = *desc.next_cached;
+            next.prev_cached = desc.prev_cached;
+            *desc.next_cached = next;
+        }
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.newer))
+        {
+            oversized_block_descriptor newer = *desc.newer;
+            newer.older = desc.older;
+            *desc.newer = newer;
+        }
+        else
+        {
+            assert(m_cached_newest == block);
+            m_cached_newest = desc.older;
+        }
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.older))
+        {
+            oversized_block_descriptor older = *desc.older;
+            older.newer = desc.newer;
+            *desc.older = older;
+        }
+        else
+        {
+            assert(m_cached_oldest == block);
+            m_cached_oldest = desc.newer;
+        }
+
+        m_cached_bytes -= desc.capacity;
+    }
+
+    // makes the list of all oversized blocks point at block where it pointed at the descriptor desc was read from
+    void relink_oversized(oversized_block_descriptor_ptr block, const oversized_block_descriptor & desc)
+    {
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.prev))
+        {
+            oversized_block_descriptor prev = *desc.prev;
+            prev.next = block;
+            *desc.prev = prev;
+        }
+        else
+        {
+            m_oversized = block;
+        }
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next))
+        {
+            oversized_block_descriptor next = *desc.next;
+            next.prev = block;
+            *desc.next = next;
+        }
+    }
+
+    // unlinks a block from the list of all oversized blocks and returns it to upstream
+    void deallocate_oversized(oversized_block_descriptor_ptr block)
+    {
+        oversized_block_descriptor desc = *block;
+
+        if (!detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.prev))
+        {
+            assert(m_oversized == block);
+            m_oversized = desc.next;
+        }
+        else
+        {
+            oversized_block_descriptor prev = *desc.prev;
+            assert(prev.next == block);
+            prev.next = desc.next;
+            *desc.prev = prev;
+        }
+
+        if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next))
+        {
+            oversized_block_descriptor next = *desc.next;
+            assert(next.prev == block);
+            next.prev = desc.prev;
+            *desc.next = next;
+        }
+
+        deallocate_upstream(block_start(block, desc.size), desc.capacity + sizeof(oversized_block_descriptor), desc.alignment);
+    }
+
+    void_ptr allocate_upstream(std::size_t bytes, std::size_t alignment)
+    {
+        void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+        Statistics::on_upstream_allocate(bytes);
+        return ret;
+    }
+
+    void deallocate_upstream(void_ptr p, std::size_t bytes, std::size_t alignment)
+    {
+        m_upstream->do_deallocate(p, bytes, alignment);
+        Statistics::on_upstream_deallocate(bytes);
+    }
+
+    // the distance between the blocks of a bucket in its chunks, including the descriptor following every block
+    std::size_t bucket_block_size(std::size_t bytes) const
+    {
+        std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
+        std::size_t block_size = bytes + descriptor_size;
+        block_size += m_options.alignment - block_size % m_options.alignment;
+        return block_size;
+    }
+
+    template<typename Pointer>
+    static const char * raw_address(Pointer p)
+    {
+        return reinterpret_cast<const char *>(detail::pointer_traits<Pointer>::get(p));
+    }
+
+    // a chunk seen by trim, and the number of its bytes taken by free blocks
+    struct chunk_usage
+    {
+        const char * begin;
+        chunk_descriptor_ptr chunk;
+        std::size_t size;
+        std::size_t free_bytes;
+
+        bool operator<(const chunk_usage & other) const
+        {
+            return begin < other.begin;
+        }
+    };
+
+    struct chunk_begins_after
+    {
+        bool operator()(const char * address, const chunk_usage & usage) const
+        {
+            return address < usage.begin;
+        }
+    };
+
+    // returns the chunk containing address, given chunks ordered by address
+    static chunk_usage & containing_chunk(std::vector<chunk_usage> & chunks, const char * address)
+    {
+        typename std::vector<chunk_usage>::iterator it = std::upper_bound(chunks.begin(), chunks.end(), address, chunk_begins_after());
+        assert(it != chunks.begin());
+        --it;
+        assert(address < it->begin + it->size);
+        return *it;
+    }
 
 public:
     /*! Releases all held memory to upstream.
@@ -232,24 +550,159 @@ public:
                     static_cast<void_ptr>(alloc)
                 ) - thrust::raw_reference_cast(*alloc).size
             );
-            m_upstream->do_deallocate(p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+            deallocate_upstream(p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
         }
 
         // deallocate cached oversized/overaligned memory
         while (detail::pointer_traits<oversized_block_descriptor_ptr>::get(m_oversized))
         {
             oversized_block_descriptor_ptr alloc = m_oversized;
-            m_oversized = thrust::raw_reference_cast(*m_oversized).next;
+            oversized_block_descriptor desc = *alloc;
+            m_oversized = desc.next;
 
-            void_ptr p = static_cast<void_ptr>(
-                static_cast<char_ptr>(
-                    static_cast<void_ptr>(alloc)
-                ) - thrust::raw_reference_cast(*alloc).size
-            );
-            m_upstream->do_deallocate(p, thrust::raw_reference_cast(*alloc).size + sizeof(oversized_block_descriptor), thrust::raw_reference_cast(*alloc).alignment);
+            deallocate_upstream(block_start(alloc, desc.size), desc.capacity + sizeof(oversized_block_descriptor), desc.alignment);
+        }
+
+        // reset the cache index
+        for (std::size_t i = 0; i < num_size_classes; ++i)
+        {
+            m_cached_classes[i] = oversized_block_descriptor_ptr();
+        }
+        for (std::size_t i = 0; i < num_size_class_words; ++i)
+        {
+            m_cached_class_mask[i] = 0;
+        }
+        m_cached_newest = oversized_block_descriptor_ptr();
+        m_cached_oldest = oversized_block_descriptor_ptr();
+        m_cached_bytes = 0;
+
+        Statistics::on_release();
+    }
+
+    /*! Returns a snapshot of the statistics collected by the pool. Only available if \p Statistics is
+     *      \p pool_statistics.
+     */
+    pool_statistics_snapshot statistics() const
+    {
+        return Statistics::snapshot();
+    }
+
+    /*! Releases the memory of chunks none of whose blocks are allocated, and of all cached oversized and overaligned
+     *      blocks, to upstream. Unlike \p release, leaves the memory that is in use intact, and can therefore be called
+     *      at any time to return the memory left idle after a peak in use.
+     */
+    void trim()
+    {
+        std::vector<chunk_usage> chunks;
+
+        for (chunk_descriptor_ptr alloc = m_allocated; detail::pointer_traits<chunk_descriptor_ptr>::get(alloc); )
+        {
+            chunk_descriptor desc = *alloc;
+
+            chunk_usage usage;
+            usage.begin = raw_address(alloc) - desc.size;
+            usage.chunk = alloc;
+            usage.size = desc.size;
+            usage.free_bytes = 0;
+            chunks.push_back(usage);
+
+            alloc = desc.next;
+        }
+
+        std::sort(chunks.begin(), chunks.end());
+
+        // count the bytes of every chunk taken by the free blocks in it
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            std::size_t block_size = bucket_block_size(static_cast<std::size_t>(1) << (i + m_smallest_block_log2));
+
+            block_descriptor_ptr block = thrust::raw_reference_cast(m_pools[i]).free_list;
+            while (detail::pointer_traits<block_descriptor_ptr>::get(block))
+            {
+                containing_chunk(chunks, raw_address(block)).free_bytes += block_size;
+                block = thrust::raw_reference_cast(*block).next;
+            }
+        }
+
+        // unlink the blocks of the chunks that are entirely free from the free lists, keeping the order of the others
+        for (std::size_t i = 0; i < m_pools.size(); ++i)
+        {
+            pool & bucket = thrust::raw_reference_cast(m_pools[i]);
+
+            block_descriptor_ptr block = bucket.free_list;
+            block_descriptor_ptr last_kept = block_descriptor_ptr();
+            bucket.free_list = block_descriptor_ptr();
+            std::size_t trimmed = 0;
+
+            while (detail::pointer_traits<block_descriptor_ptr>::get(block))
+            {
+                block_descriptor desc = *block;
+
+                chunk_usage & usage = containing_chunk(chunks, raw_address(block));
+                if (usage.free_bytes != usage.size)
+                {
+                    if (detail::pointer_traits<block_descriptor_ptr>::get(last_kept))
+                    {
+                        block_descriptor last = *last_kept;
+                        last.next = block;
+                        *last_kept = last;
+                    }
+                    else
+                    {
+                        bucket.free_list = block;
+                    }
+
+                    last_kept = block;
+                }
+                else
+                {
+                    ++trimmed;
+                }
+
+                block = desc.next;
+            }
+
+            Statistics::on_blocks_trimmed(i, trimmed);
+
+            if (detail::pointer_traits<block_descriptor_ptr>::get(last_kept))
+            {
+                block_descriptor last = *last_kept;
+                last.next = block_descriptor_ptr();
+                *last_kept = last;
+            }
+        }
+
+        // return the chunks that are entirely free to upstream, and relink the others
+        m_allocated = chunk_descriptor_ptr();
+
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            if (chunks[i].free_bytes == chunks[i].size)
+            {
+                void_ptr p = static_cast<void_ptr>(
+                    static_cast<char_ptr>(
+                        static_cast<void_ptr>(chunks[i].chunk)
+                    ) - chunks[i].size
+                );
+                deallocate_upstream(p, chunks[i].size + sizeof(chunk_descriptor), m_options.alignment);
+                Statistics::on_chunk_deallocate();
+            }
+            else
+            {
+                chunk_descriptor desc = *chunks[i].chunk;
+                desc.next = m_allocated;
+                *chunks[i].chunk = desc;
+                m_allocated = chunks[i].chunk;
+            }
         }
 
-        m_cached_oversized = oversized_block_descriptor_ptr();
+        // return the cached oversized/overaligned memory to upstream
+        while (detail::pointer_traits<oversized_block_descriptor_ptr>::get(m_cached_oldest))
+        {
+            oversized_block_descriptor_ptr oldest = m_cached_oldest;
+            erase_cached(oldest);
+            deallocate_oversized(oldest);
+        }
     }
 
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -262,79 +715,71 @@ public:
         {
             if (m_options.cache_oversized)
             {
-                oversized_block_descriptor_ptr ptr = m_cached_oversized;
-                oversized_block_descriptor_ptr * previous = &m_cached_oversized;
-                while (detail::pointer_traits<oversized_block_descriptor_ptr>::get(ptr))
+                // every block of a size class at least as large as the one bytes rounds up to fits;
+                // take the most recently cached one which is aligned well enough
+                std::size_t cls = find_cached_class(size_class(round_to_size_class(bytes)));
+                while (cls < num_size_classes)
                 {
+                    oversized_block_descriptor_ptr ptr = m_cached_classes[cls];
                     oversized_block_descriptor desc = *ptr;
-                    bool is_good = desc.size >= bytes && desc.alignment >= alignment;
 
                     // if the size is bigger than the requested size by a factor
                     // bigger than or equal to the specified cutoff for size,
-                    // allocate a new block
-                    if (is_good)
+                    // allocate a new block; so is every block of the later classes
+                    std::size_t size_factor = desc.capacity / bytes;
+                    if (size_factor >= m_options.cached_size_cutoff_factor)
                     {
-                        std::size_t size_factor = desc.size / bytes;
-                        if (size_factor >= m_options.cached_size_cutoff_factor)
-                        {
-                            is_good = false;
-                        }
+                        break;
                     }
 
-                    // if the alignment is bigger than the requested one by a factor
-                    // bigger than or equal to the specified cutoff for alignment,
-                    // allocate a new block
-                    if (is_good)
+                    while (detail::pointer_traits<oversized_block_descriptor_ptr>::get(ptr))
                     {
-                        std::size_t alignment_factor = desc.alignment / alignment;
-                        if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-                        {
-                            is_good = false;
-                        }
-                    }
+                        desc = *ptr;
 
-                    if (is_good)
-                    {
-                        if (previous != &m_cached_oversized)
+                        // if the alignment is bigger than the requested one by a factor
+                        // bigger than or equal to the specified cutoff for alignment,
+                        // allocate a new block
+                        if (desc.alignment >= alignment
+                            && desc.alignment / alignment < m_options.cached_alignment_cutoff_factor)
                         {
-                            oversized_block_descriptor previous_desc = **previous;
-                            previous_desc.next_cached = desc.next_cached;
-                            **previous = previous_desc;
-                        }
-                        else
-                        {
-                            m_cached_oversized = desc.next_cached;
+                            erase_cached(ptr);
+
+                            // the descriptor follows the allocation, which deallocation finds by its size,
+                            // so move it if the block was last used for a different size
+                            void_ptr p = block_start(ptr, desc.size);
+                            desc = *ptr;
+                            desc.size = bytes;
+                            oversized_block_descriptor_ptr block = descriptor_of(p, bytes);
+                            *block = desc;
+                            relink_oversized(block, desc);
+
+                            Statistics::on_oversized_allocate(bytes, true);
+                            return p;
                         }
 
-                        desc.next_cached = oversized_block_descriptor_ptr();
-                        *ptr = desc;
-
-                        return static_cast<void_ptr>(
-                            static_cast<char_ptr>(
-                                static_cast<void_ptr>(ptr)
-                            ) - desc.size
-                        );
+                        ptr = desc.next_cached;
                     }
 
-                    previous = &thrust::raw_reference_cast(*ptr).next_cached;
-                    ptr = *previous;
+                    cls = find_cached_class(cls + 1);
                 }
             }
 
-            // no fitting cached block found; allocate a new one that's just up to the specs
-            void_ptr allocated = m_upstream->do_allocate(bytes + sizeof(oversized_block_descriptor), alignment);
-            oversized_block_descriptor_ptr block = static_cast<oversized_block_descriptor_ptr>(
-                static_cast<void_ptr>(
-                    static_cast<char_ptr>(allocated) + bytes
-                )
-            );
+            // no fitting cached block found; allocate a new one that's just up to the specs,
+            // rounded up to its size class if it's going to be cached later
+            std::size_t capacity = m_options.cache_oversized ? round_to_size_class(bytes) : bytes;
+            void_ptr allocated = allocate_upstream(capacity + sizeof(oversized_block_descriptor), alignment);
+            oversized_block_descriptor_ptr block = descriptor_of(allocated, bytes);
 
             oversized_block_descriptor desc;
             desc.size = bytes;
+            desc.capacity = capacity;
             desc.alignment = alignment;
             desc.prev = oversized_block_descriptor_ptr();
             desc.next = m_oversized;
+            desc.prev_cached = oversized_block_descriptor_ptr();
             desc.next_cached = oversized_block_descriptor_ptr();
+            desc.newer = oversized_block_descriptor_ptr();
+            desc.older = oversized_block_descriptor_ptr();
             *block = desc;
             m_oversized = block;
 
@@ -345,6 +790,7 @@ public:
                 *desc.next = next;
             }
 
+            Statistics::on_oversized_allocate(bytes, false);
             return allocated;
         }
 
@@ -382,12 +828,10 @@ public:
                 }
             }
 
-            std::size_t descriptor_size = (std::max)(sizeof(block_descriptor), m_options.alignment);
-            std::size_t block_size = bytes + descriptor_size;
-            block_size += m_options.alignment - block_size % m_options.alignment;
+            std::size_t block_size = bucket_block_size(bytes);
             std::size_t chunk_size = block_size * n;
 
-            void_ptr allocated = m_upstream->do_allocate(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
+            void_ptr allocated = allocate_upstream(chunk_size + sizeof(chunk_descriptor), m_options.alignment);
             chunk_descriptor_ptr chunk = static_cast<chunk_descriptor_ptr>(
                 static_cast<void_ptr>(
                     static_cast<char_ptr>(allocated) + chunk_size
@@ -413,11 +857,14 @@ public:
                 *block = block_desc;
                 bucket.free_list = block;
             }
+
+            Statistics::on_chunk_allocate(bucket_idx, n);
         }
 
         // allocate a block from the front of the bucket's free list
         block_descriptor_ptr block = bucket.free_list;
         bucket.free_list = thrust::raw_reference_cast(*block).next;
+        Statistics::on_block_allocate(bucket_idx);
         return static_cast<void_ptr>(
             static_cast<char_ptr>(
                 static_cast<void_ptr>(block)
@@ -436,45 +883,30 @@ public:
         // the deallocated block is oversized and/or overaligned
         if (n > m_options.largest_block_size || alignment > m_options.alignment)
         {
-            oversized_block_descriptor_ptr block = static_cast<oversized_block_descriptor_ptr>(
-                static_cast<void_ptr>(
-                    static_cast<char_ptr>(p) + n
-                )
-            );
+            oversized_block_descriptor_ptr block = descriptor_of(p, n);
+            assert(thrust::raw_reference_cast(*block).size == n);
 
-            oversized_block_descriptor desc = *block;
+            Statistics::on_oversized_deallocate(n);
 
-            if (m_options.cache_oversized)
+            // blocks larger than the whole cache go straight back to upstream
+            if (m_options.cache_oversized
+                && (m_options.max_cached_bytes == 0
+                    || thrust::raw_reference_cast(*block).capacity <= m_options.max_cached_bytes))
             {
-                desc.next_cached = m_cached_oversized;
-                *block = desc;
-                m_cached_oversized = block;
-
-                return;
-            }
+                push_cached(block);
 
-            if (!detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.prev))
-            {
-                assert(m_oversized == block);
-                m_oversized = desc.next;
-            }
-            else
-            {
-                oversized_block_descriptor prev = *desc.prev;
-                assert(prev.next == block);
-                prev.next = desc.next;
-                *desc.prev = prev;
-            }
+                // return the least recently cached blocks to upstream while the cache is over its limit
+                while (m_options.max_cached_bytes != 0 && m_cached_bytes > m_options.max_cached_bytes)
+                {
+                    oversized_block_descriptor_ptr oldest = m_cached_oldest;
+                    erase_cached(oldest);
+                    deallocate_oversized(oldest);
+                }
 
-            if (detail::pointer_traits<oversized_block_descriptor_ptr>::get(desc.next))
-            {
-                oversized_block_descriptor next = *desc.next;
-                assert(next.prev == block);
-                next.prev = desc.prev;
-                *desc.next = next;
+                return;
             }
 
-            m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+            deallocate_oversized(block);
 
             return;
         }
@@ -496,6 +928,41 @@ public:
         desc.next = bucket.free_list;
         *block = desc;
         bucket.free_list = block;
+
+        Statistics::on_block_deallocate(bucket_idx);
+    }
+};
+
+/*! A memory resource adaptor allowing for pooling and caching allocations from \p Upstream, using memory allocated
+ *      from it for both blocks then allocated to the user and for internal bookkeeping of the cached memory. See
+ *      \p basic_unsynchronized_pool_resource, of which this is the version that collects no statistics.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template<typename Upstream>
+class unsynchronized_pool_resource final
+    : public basic_unsynchronized_pool_resource<Upstream, no_pool_statistics>
+{
+    typedef basic_unsynchronized_pool_resource<Upstream, no_pool_statistics> base;
+
+public:
+    /*! Constructor.
+     *
+     *  \param upstream the upstream memory resource for allocations
+     *  \param options pool options to use
+     */
+    unsynchronized_pool_resource(Upstream * upstream, pool_options options = base::get_default_options())
+        : base(upstream, options)
+    {
+    }
+
+    /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+     *
+     *  \param options pool options to use
+     */
+    unsynchronized_pool_resource(pool_options options = base::get_default_options())
+        : base(options)
+    {
     }
 };
 
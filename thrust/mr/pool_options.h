@@ -1,5 +1,6 @@
 /*
  *  Copyright 2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -90,6 +91,17 @@ struct pool_options
      */
     std::size_t cached_alignment_cutoff_factor;
 
+    /*! The maximal number of bytes held by cached oversized and overaligned blocks, or zero for no limit. When returning
+     *      a block to the cache makes the cached blocks exceed this size, the least recently cached blocks are released
+     *      to the upstream resource until they fit again.
+     */
+    std::size_t max_cached_bytes;
+
+    /*! The number of blocks of every size that each per-thread magazine of \p concurrent_pool_resource holds before
+     *      returning half of them to the shared pool, or zero to disable the magazines. Ignored by the other pools.
+     */
+    std::size_t magazine_size;
+
     /*! Checks if the options are self-consistent.
      *
      *  /returns true if the options are self-consitent, false otherwise.
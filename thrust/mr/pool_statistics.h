@@ -0,0 +1,231 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief Policies deciding whether the pooling resource adaptors collect statistics about their use.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <cstddef>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The statistics of a single bucket, i.e. the pool of blocks of a single size, of a pooling resource adaptor.
+ */
+struct pool_bucket_statistics
+{
+    /*! The size of the blocks of the bucket. */
+    std::size_t block_size;
+    /*! The number of blocks allocated from the bucket. */
+    std::size_t allocations;
+    /*! The number of blocks returned to the bucket. */
+    std::size_t deallocations;
+    /*! The number of free blocks currently in the bucket. */
+    std::size_t free_blocks;
+};
+
+/*! The statistics collected by a pooling resource adaptor using \p pool_statistics, as returned by its
+ *      \p statistics member function.
+ */
+struct pool_statistics_snapshot
+{
+    /*! The statistics of every bucket, from the one with the smallest blocks to the one with the largest blocks. */
+    std::vector<pool_bucket_statistics> buckets;
+
+    /*! The number of chunks, which are split into the blocks of the buckets, currently allocated from upstream. */
+    std::size_t chunks;
+
+    /*! The number of allocations from the upstream resource. */
+    std::size_t upstream_allocations;
+    /*! The number of deallocations to the upstream resource. */
+    std::size_t upstream_deallocations;
+    /*! The number of bytes currently allocated from the upstream resource. */
+    std::size_t upstream_bytes;
+    /*! The highest number of bytes allocated from the upstream resource at any time. */
+    std::size_t peak_upstream_bytes;
+
+    /*! The number of bytes currently allocated from the pool, counting the whole block for pooled allocations. */
+    std::size_t bytes_in_use;
+    /*! The highest number of bytes allocated from the pool at any time. */
+    std::size_t peak_bytes_in_use;
+
+    /*! The number of oversized and overaligned allocations served by a cached block. */
+    std::size_t oversized_cache_hits;
+    /*! The number of oversized and overaligned allocations that had to be allocated from upstream. */
+    std::size_t oversized_cache_misses;
+};
+
+/*! The statistics policy of the pooling resource adaptors that collects nothing. It is the default, and adds neither
+ *      space nor time to the adaptors.
+ */
+struct no_pool_statistics
+{
+    void on_construct(std::size_t, std::size_t) {}
+    void on_release() {}
+
+    void on_upstream_allocate(std::size_t) {}
+    void on_upstream_deallocate(std::size_t) {}
+
+    void on_chunk_allocate(std::size_t, std::size_t) {}
+    void on_chunk_deallocate() {}
+    void on_blocks_trimmed(std::size_t, std::size_t) {}
+
+    void on_block_allocate(std::size_t) {}
+    void on_block_deallocate(std::size_t) {}
+
+    void on_oversized_allocate(std::size_t, bool) {}
+    void on_oversized_deallocate(std::size_t) {}
+};
+
+/*! The statistics policy of the pooling resource adaptors that counts the events of a pool and the memory it holds.
+ *      The counts are updated by the pool, and are therefore synchronized like the pool is; \p snapshot returns a copy.
+ */
+class pool_statistics
+{
+public:
+    pool_statistics() : m_stats()
+    {
+    }
+
+    /*! Returns a copy of the statistics collected so far. */
+    pool_statistics_snapshot snapshot() const
+    {
+        return m_stats;
+    }
+
+    void on_construct(std::size_t num_buckets, std::size_t smallest_block_size)
+    {
+        pool_bucket_statistics bucket = { 0, 0, 0, 0 };
+        m_stats.buckets.resize(num_buckets, bucket);
+
+        for (std::size_t i = 0; i < num_buckets; ++i)
+        {
+            m_stats.buckets[i].block_size = smallest_block_size << i;
+        }
+    }
+
+    // every block and chunk is released at once
+    void on_release()
+    {
+        for (std::size_t i = 0; i < m_stats.buckets.size(); ++i)
+        {
+            m_stats.buckets[i].free_blocks = 0;
+        }
+
+        m_stats.chunks = 0;
+        m_stats.bytes_in_use = 0;
+    }
+
+    void on_upstream_allocate(std::size_t bytes)
+    {
+        ++m_stats.upstream_allocations;
+        m_stats.upstream_bytes += bytes;
+
+        if (m_stats.upstream_bytes > m_stats.peak_upstream_bytes)
+        {
+            m_stats.peak_upstream_bytes = m_stats.upstream_bytes;
+        }
+    }
+
+    void on_upstream_deallocate(std::size_t bytes)
+    {
+        ++m_stats.upstream_deallocations;
+        m_stats.upstream_bytes -= bytes;
+    }
+
+    void on_chunk_allocate(std::size_t bucket, std::size_t blocks)
+    {
+        ++m_stats.chunks;
+        m_stats.buckets[bucket].free_blocks += blocks;
+    }
+
+    void on_chunk_deallocate()
+    {
+        --m_stats.chunks;
+    }
+
+    void on_blocks_trimmed(std::size_t bucket, std::size_t blocks)
+    {
+        m_stats.buckets[bucket].free_blocks -= blocks;
+    }
+
+    void on_block_allocate(std::size_t bucket)
+    {
+        pool_bucket_statistics & stats = m_stats.buckets[bucket];
+        ++stats.allocations;
+        --stats.free_blocks;
+
+        add_bytes_in_use(stats.block_size);
+    }
+
+    void on_block_deallocate(std::size_t bucket)
+    {
+        pool_bucket_statistics & stats = m_stats.buckets[bucket];
+        ++stats.deallocations;
+        ++stats.free_blocks;
+
+        m_stats.bytes_in_use -= stats.block_size;
+    }
+
+    void on_oversized_allocate(std::size_t bytes, bool cache_hit)
+    {
+        if (cache_hit)
+        {
+            ++m_stats.oversized_cache_hits;
+        }
+        else
+        {
+            ++m_stats.oversized_cache_misses;
+        }
+
+        add_bytes_in_use(bytes);
+    }
+
+    void on_oversized_deallocate(std::size_t bytes)
+    {
+        m_stats.bytes_in_use -= bytes;
+    }
+
+private:
+    pool_statistics_snapshot m_stats;
+
+    void add_bytes_in_use(std::size_t bytes)
+    {
+        m_stats.bytes_in_use += bytes;
+
+        if (m_stats.bytes_in_use > m_stats.peak_bytes_in_use)
+        {
+            m_stats.peak_bytes_in_use = m_stats.bytes_in_use;
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
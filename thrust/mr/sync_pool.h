@@ -1,5 +1,6 @@
 /*
  *  Copyright 2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -87,6 +88,14 @@ public:
         upstream_pool.release();
     }
 
+    /*! Releases the memory of chunks none of whose blocks are allocated, and of all cached blocks, to upstream.
+     */
+    void trim()
+    {
+        lock_t lock(mtx);
+        upstream_pool.trim();
+    }
+
     THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
     {
         lock_t lock(mtx);
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -15,7 +16,7 @@
  */
 
 /*! \file tls_pool.h
- *  \brief A function wrapping a thread local instance of a \p unsynchronized_pool_resource.
+ *  \brief Functions wrapping a thread local instance of a \p unsynchronized_pool_resource.
  */
 
 #pragma once
@@ -26,6 +27,7 @@
 #if THRUST_CPP_DIALECT >= 2011
 
 #include <thrust/mr/pool.h>
+#include <thrust/mr/tls_pool_resource.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -54,6 +56,26 @@ thrust::mr::unsynchronized_pool_resource<Upstream> & tls_pool(Upstream * upstrea
     return adaptor;
 }
 
+/*! Potentially constructs, if not yet created, and then returns the address of a thread-local \p unsynchronized_pool_resource
+ *      owned by a \p tls_pool_resource, which lets other threads deallocate the blocks allocated from it. The pool is
+ *      distinct from the one returned by \p tls_pool.
+ *
+ *  \tparam Upstream the template argument to the pool template
+ *  \param upstream the argument to the constructor, if invoked
+ */
+template<typename Upstream>
+__host__
+thrust::mr::tls_pool_resource<thrust::mr::unsynchronized_pool_resource<Upstream> > &
+tls_pool_with_remote_frees(Upstream * upstream = NULL)
+{
+    static thread_local thrust::mr::tls_pool_resource<thrust::mr::unsynchronized_pool_resource<Upstream> > adaptor([&]{
+        assert(upstream);
+        return upstream;
+    }());
+
+    return adaptor;
+}
+
 /*! \}
  */
 
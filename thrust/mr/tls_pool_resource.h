@@ -0,0 +1,250 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file tls_pool_resource.h
+ *  \brief A memory resource adaptor owning an unsynchronized pool used by a single thread, which other threads can
+ *  return blocks to.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/cpp11_required.h>
+
+#if THRUST_CPP_DIALECT >= 2011
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <thrust/mr/memory_resource.h>
+
+#include <cassert>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor owning an unsynchronized pool resource, which belongs to the thread that constructs the
+ *      adaptor. This is the resource returned by \p tls_pool_with_remote_frees and
+ *      \p tls_disjoint_pool_with_remote_frees.
+ *
+ *  Only the owning thread may allocate from the adaptor, but any thread may deallocate a block allocated from it.
+ *      Blocks deallocated by other threads are put on a queue guarded by a mutex, and the owning thread returns them
+ *      to its pool the next time it allocates, deallocates or calls \p trim, and when the adaptor is destroyed, so a block
+ *      always goes back to the pool it came from. The owning thread only locks the queue when it isn't empty. An
+ *      owning thread which stops allocating never reclaims the blocks other threads deallocate, until it calls
+ *      \p trim.
+ *
+ *  The adaptor also tracks how many bytes are in use, and the highest value of that since the pool was last trimmed.
+ *      When the bytes in use drop below that high-water mark by more than \p trim_threshold bytes, the pool is trimmed,
+ *      returning the chunks with no blocks in use and all cached blocks to upstream. \p trim can also be called
+ *      explicitly.
+ *
+ *  Blocks must be deallocated before the owning thread exits, because the pool is destroyed, and all of its memory
+ *      released, with the thread. Deallocating a block after that, from any thread, is undefined behavior.
+ *
+ *  \tparam Pool the type of the pool resource owned by the adaptor; \p unsynchronized_pool_resource or
+ *      \p disjoint_unsynchronized_pool_resource
+ */
+template<typename Pool>
+class tls_pool_resource final : public memory_resource<typename Pool::pointer>
+{
+    typedef std::lock_guard<std::mutex> lock_t;
+
+    typedef typename Pool::pointer void_ptr;
+
+public:
+    /*! Constructor. Constructs the owned pool from the arguments; the calling thread becomes the owning thread.
+     *
+     *  \param args the arguments to the constructor of the pool
+     */
+    template<typename... Args>
+    explicit tls_pool_resource(Args &&... args)
+        : m_pool(std::forward<Args>(args)...),
+        m_owner(std::this_thread::get_id()),
+        m_has_remote_frees(false),
+        m_bytes_in_use(0),
+        m_high_water_mark(0),
+        m_trim_threshold(0)
+    {
+    }
+
+    /*! Destructor. Returns the blocks deallocated by other threads to the pool before the pool is destroyed.
+     */
+    ~tls_pool_resource()
+    {
+        collect_remote_frees();
+    }
+
+    /*! Returns the number of bytes by which the bytes in use have to drop below their high-water mark for the pool to
+     *      be trimmed. Zero, the default, means that the pool is only trimmed by calls to \p trim.
+     */
+    std::size_t trim_threshold() const
+    {
+        return m_trim_threshold;
+    }
+
+    /*! Sets the number of bytes by which the bytes in use have to drop below their high-water mark for the pool to be
+     *      trimmed. Zero means that the pool is only trimmed by calls to \p trim. Must be called by the owning thread.
+     *
+     *  \param bytes the new threshold
+     */
+    void set_trim_threshold(std::size_t bytes)
+    {
+        assert(std::this_thread::get_id() == m_owner);
+        m_trim_threshold = bytes;
+    }
+
+    /*! Returns the blocks deallocated by other threads to the pool, and then releases the memory of chunks with no
+     *      blocks in use and of all cached blocks to upstream. Must be called by the owning thread.
+     */
+    void trim()
+    {
+        assert(std::this_thread::get_id() == m_owner);
+
+        collect_remote_frees();
+        m_pool.trim();
+        m_high_water_mark = m_bytes_in_use;
+    }
+
+    /*! Releases all held memory to upstream. Must be called by the owning thread.
+     */
+    void release()
+    {
+        assert(std::this_thread::get_id() == m_owner);
+
+        {
+            lock_t lock(m_remote_mtx);
+            m_remote_frees.clear();
+            m_has_remote_frees.store(false, std::memory_order_relaxed);
+        }
+
+        m_pool.release();
+        m_bytes_in_use = 0;
+        m_high_water_mark = 0;
+    }
+
+    THRUST_NODISCARD virtual void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        assert(std::this_thread::get_id() == m_owner);
+
+        collect_remote_frees();
+        trim_if_idle();
+
+        void_ptr ret = m_pool.do_allocate(bytes, alignment);
+
+        m_bytes_in_use += bytes;
+        if (m_bytes_in_use > m_high_water_mark)
+        {
+            m_high_water_mark = m_bytes_in_use;
+        }
+
+        return ret;
+    }
+
+    virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+    {
+        // leave the block for the owning thread to return to its pool
+        if (std::this_thread::get_id() != m_owner)
+        {
+            remote_free block = { p, n, alignment };
+
+            lock_t lock(m_remote_mtx);
+            m_remote_frees.push_back(block);
+            m_has_remote_frees.store(true, std::memory_order_release);
+
+            return;
+        }
+
+        collect_remote_frees();
+
+        m_pool.do_deallocate(p, n, alignment);
+        m_bytes_in_use -= n;
+
+        trim_if_idle();
+    }
+
+private:
+    struct remote_free
+    {
+        void_ptr pointer;
+        std::size_t size;
+        std::size_t alignment;
+    };
+
+    Pool m_pool;
+    std::thread::id m_owner;
+
+    // blocks deallocated by other threads, and whether there are any
+    std::mutex m_remote_mtx;
+    std::vector<remote_free> m_remote_frees;
+    std::atomic<bool> m_has_remote_frees;
+    // the blocks being returned to the pool by the owning thread; swapped with
+    // the above, so that neither has to grow again once it has grown enough
+    std::vector<remote_free> m_collected_frees;
+
+    std::size_t m_bytes_in_use;
+    std::size_t m_high_water_mark;
+    std::size_t m_trim_threshold;
+
+    // returns the blocks deallocated by other threads to the pool
+    void collect_remote_frees()
+    {
+        if (!m_has_remote_frees.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        {
+            lock_t lock(m_remote_mtx);
+            m_collected_frees.swap(m_remote_frees);
+            m_has_remote_frees.store(false, std::memory_order_relaxed);
+        }
+
+        for (std::size_t i = 0; i < m_collected_frees.size(); ++i)
+        {
+            m_pool.do_deallocate(m_collected_frees[i].pointer, m_collected_frees[i].size, m_collected_frees[i].alignment);
+            m_bytes_in_use -= m_collected_frees[i].size;
+        }
+
+        m_collected_frees.clear();
+    }
+
+    void trim_if_idle()
+    {
+        if (m_trim_threshold != 0 && m_high_water_mark - m_bytes_in_use > m_trim_threshold)
+        {
+            m_pool.trim();
+            m_high_water_mark = m_bytes_in_use;
+        }
+    }
+};
+
+/*! \} // memory_resources
+ */
+
+} // end mr
+THRUST_NAMESPACE_END
+
+#endif // THRUST_CPP_DIALECT >= 2011
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -218,6 +219,102 @@ __host__ __device__
             StrictWeakOrdering comp);
 
 
+/*! \p sort sorts the arithmetic keys in <tt>[first, last)</tt> into
+ *  ascending order of the bits <tt>[begin_bit, end_bit)</tt> of their radix
+ *  encoding. The encoding of an unsigned integer is the integer itself; that of
+ *  a signed integer or a floating point number flips its sign bit (and, for
+ *  negative floating point numbers, all other bits as well), so that the
+ *  encodings of all keys order them as \c operator< does. Keys whose selected
+ *  bits are equal are equivalent, and this version of \p sort preserves their
+ *  relative order.
+ *
+ *  Sorting fewer bits takes fewer radix passes: keys known to fit into their
+ *  low \c k bits can be sorted with <tt>begin_bit = 0, end_bit = k</tt>.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param begin_bit The least significant bit of the encoding to sort by.
+ *  \param end_bit One past the most significant bit of the encoding to sort by.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is an arithmetic type.
+ *
+ *  \pre <tt>begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p sort to sort
+ *  64-bit keys which fit into their low 34 bits using the \p thrust::host
+ *  execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  unsigned long long A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::sort(thrust::host, A, A + N, 0, 34);
+ *  // A is now {1, 2, 4, 5, 7, 8}
+ *  \endcode
+ *
+ *  \see \p stable_sort
+ *  \see \p sort_by_key
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void sort(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            unsigned int begin_bit,
+            unsigned int end_bit);
+
+
+/*! \p sort sorts the arithmetic keys in <tt>[first, last)</tt> into
+ *  ascending order of the bits <tt>[begin_bit, end_bit)</tt> of their radix
+ *  encoding. The encoding of an unsigned integer is the integer itself; that of
+ *  a signed integer or a floating point number flips its sign bit (and, for
+ *  negative floating point numbers, all other bits as well), so that the
+ *  encodings of all keys order them as \c operator< does. Keys whose selected
+ *  bits are equal are equivalent, and this version of \p sort preserves their
+ *  relative order.
+ *
+ *  \param first The beginning of the sequence.
+ *  \param last The end of the sequence.
+ *  \param begin_bit The least significant bit of the encoding to sort by.
+ *  \param end_bit One past the most significant bit of the encoding to sort by.
+ *
+ *  \tparam RandomAccessIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator is mutable,
+ *          and \p RandomAccessIterator's \c value_type is an arithmetic type.
+ *
+ *  \pre <tt>begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>.
+ *
+ *  The following code snippet demonstrates how to use \p sort to sort
+ *  64-bit keys which fit into their low 34 bits.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 6;
+ *  unsigned long long A[N] = {1, 4, 2, 8, 5, 7};
+ *  thrust::sort(A, A + N, 0, 34);
+ *  // A is now {1, 2, 4, 5, 7, 8}
+ *  \endcode
+ *
+ *  \see \p stable_sort
+ *  \see \p sort_by_key
+ */
+template<typename RandomAccessIterator>
+  void sort(RandomAccessIterator first,
+            RandomAccessIterator last,
+            unsigned int begin_bit,
+            unsigned int end_bit);
+
+
 /*! \p stable_sort is much like \c sort: it sorts the elements in
  *  <tt>[first, last)</tt> into ascending order, meaning that if \c i
  *  and \c j are any two valid iterators in <tt>[first, last)</tt> such
@@ -671,6 +768,116 @@ template<typename RandomAccessIterator1,
                    StrictWeakOrdering comp);
 
 
+/*! \p sort_by_key performs a key-value sort of arithmetic keys by the bits
+ *  <tt>[begin_bit, end_bit)</tt> of their radix encoding. That is, it sorts the
+ *  elements in <tt>[keys_first, keys_last)</tt> and <tt>[values_first,
+ *  values_first + (keys_last - keys_first))</tt> into ascending order of the
+ *  selected bits of the keys. The encoding is the one described for \p sort.
+ *  Keys whose selected bits are equal are equivalent, and this version of
+ *  \p sort_by_key preserves the relative order of equivalent keys and of
+ *  their values.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_bit The least significant bit of the encoding to sort by.
+ *  \param end_bit One past the most significant bit of the encoding to sort by.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is an arithmetic type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *  \pre <tt>begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>, where \c value_type is the key type.
+ *
+ *  The following code snippet demonstrates how to use \p sort_by_key to sort
+ *  an array of character values using the low 34 bits of 64-bit keys as sorting
+ *  keys using the \p thrust::host execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/execution_policy.h>
+ *  ...
+ *  const int N = 6;
+ *  unsigned long long keys[N] = {  1,   4,   2,   8,   5,   7};
+ *  char             values[N] = {'a', 'b', 'c', 'd', 'e', 'f'};
+ *  thrust::sort_by_key(thrust::host, keys, keys + N, values, 0, 34);
+ *  // keys is now   {  1,   2,   4,   5,   7,   8}
+ *  // values is now {'a', 'c', 'b', 'e', 'f', 'd'}
+ *  \endcode
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p sort
+ */
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(const thrust::detail::execution_policy_base<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit);
+
+
+/*! \p sort_by_key performs a key-value sort of arithmetic keys by the bits
+ *  <tt>[begin_bit, end_bit)</tt> of their radix encoding. That is, it sorts the
+ *  elements in <tt>[keys_first, keys_last)</tt> and <tt>[values_first,
+ *  values_first + (keys_last - keys_first))</tt> into ascending order of the
+ *  selected bits of the keys. The encoding is the one described for \p sort.
+ *  Keys whose selected bits are equal are equivalent, and this version of
+ *  \p sort_by_key preserves the relative order of equivalent keys and of
+ *  their values.
+ *
+ *  \param keys_first The beginning of the key sequence.
+ *  \param keys_last The end of the key sequence.
+ *  \param values_first The beginning of the value sequence.
+ *  \param begin_bit The least significant bit of the encoding to sort by.
+ *  \param end_bit One past the most significant bit of the encoding to sort by.
+ *
+ *  \tparam RandomAccessIterator1 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          \p RandomAccessIterator1 is mutable,
+ *          and \p RandomAccessIterator1's \c value_type is an arithmetic type.
+ *  \tparam RandomAccessIterator2 is a model of <a href="https://en.cppreference.com/w/cpp/iterator/random_access_iterator">Random Access Iterator</a>,
+ *          and \p RandomAccessIterator2 is mutable.
+ *
+ *  \pre The range <tt>[keys_first, keys_last))</tt> shall not overlap the range <tt>[values_first, values_first + (keys_last - keys_first))</tt>.
+ *  \pre <tt>begin_bit <= end_bit <= 8 * sizeof(value_type)</tt>, where \c value_type is the key type.
+ *
+ *  The following code snippet demonstrates how to use \p sort_by_key to sort
+ *  an array of character values using the low 34 bits of 64-bit keys as sorting
+ *  keys.
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  ...
+ *  const int N = 6;
+ *  unsigned long long keys[N] = {  1,   4,   2,   8,   5,   7};
+ *  char             values[N] = {'a', 'b', 'c', 'd', 'e', 'f'};
+ *  thrust::sort_by_key(keys, keys + N, values, 0, 34);
+ *  // keys is now   {  1,   2,   4,   5,   7,   8}
+ *  // values is now {'a', 'c', 'b', 'e', 'f', 'd'}
+ *  \endcode
+ *
+ *  \see \p stable_sort_by_key
+ *  \see \p sort
+ */
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void sort_by_key(RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit);
+
+
 /*! \p stable_sort_by_key performs a key-value sort. That is, \p stable_sort_by_key
  *  sorts the elements in <tt>[keys_first, keys_last)</tt> and <tt>[values_first,
  *  values_first + (keys_last - keys_first))</tt> into ascending key order,
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -68,6 +69,28 @@ __host__ __device__
                    StrictWeakOrdering comp);
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void sort(thrust::execution_policy<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            unsigned int begin_bit,
+            unsigned int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit);
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator>
 __host__ __device__
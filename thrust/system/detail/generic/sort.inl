@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -27,6 +28,9 @@
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/tuple.h>
 #include <thrust/detail/internal_functional.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -93,6 +97,52 @@ __host__ __device__
 } // end sort_by_key()
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+  void sort(thrust::execution_policy<DerivedPolicy> &exec,
+            RandomAccessIterator first,
+            RandomAccessIterator last,
+            unsigned int begin_bit,
+            unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<value_type>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  // implement with stable_sort on the selected bits
+  thrust::system::detail::sequential::radix_sort_detail::radix_bits_less<value_type> comp(begin_bit, end_bit);
+  thrust::stable_sort(exec, first, last, comp);
+} // end sort()
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+  void sort_by_key(thrust::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<value_type>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  // implement with stable_sort_by_key on the selected bits
+  thrust::system::detail::sequential::radix_sort_detail::radix_bits_less<value_type> comp(begin_bit, end_bit);
+  thrust::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+} // end sort_by_key()
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator>
 __host__ __device__
@@ -0,0 +1,306 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file compact_tiles.h
+ *  \brief Serial kernels shared by the in-place stream compactions
+ *         (remove_if, unique) of the host parallel backends.
+ *
+ *  An in-place compaction runs in two phases:
+ *    1. every tile is compacted to its front independently, recording the
+ *       range [kept_begin, kept_end) of the elements it keeps,
+ *    2. the kept ranges are moved left to follow each other.
+ *
+ *  No tile reads outside of itself during the first phase. In the second
+ *  phase, every output position p receives the kept element at source(p) >= p,
+ *  and source(p) - p, the distance the element moves, never decreases with p.
+ *  The output is written in passes over windows of consecutive positions, from
+ *  left to right, and every window is split into one piece per tile. A pass
+ *  runs in two parallel steps over the pieces:
+ *    a. every piece buffers the elements whose sources lie in the rest of the
+ *       window, where other pieces write,
+ *    b. every piece copies its other elements directly and its buffered ones
+ *       from the buffer.
+ *  A window ends where the elements of a piece landing on later pieces could
+ *  overflow a buffer of fixed size, or is no longer than the distance it moves,
+ *  so that no piece buffers anything. The distances only grow, so windows grow
+ *  as the compaction proceeds. The scratch space is a few indices per tile and
+ *  a buffer of fixed size per tile, independent of the size of the input.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/copy.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+namespace compact_tiles_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const std::size_t buffer_bytes_per_tile = 1 << 16;
+
+
+} // end namespace compact_tiles_detail
+
+
+// computes where the range kept by every tile moves to, targets[i]; targets holds
+// num_tiles + 1 elements, the last of which is the end of the compacted range, and
+// returns the furthest any kept element moves
+template<typename Size>
+Size plan_compacted_tiles_shift(const Size *kept_begins,
+                                const Size *kept_ends,
+                                Size num_tiles,
+                                Size *targets)
+{
+  Size result = 0;
+  Size max_distance = 0;
+
+  for(Size i = 0; i < num_tiles; ++i)
+  {
+    targets[i] = result;
+
+    if(kept_begins[i] != kept_ends[i])
+    {
+      max_distance = (thrust::max)(max_distance, kept_begins[i] - result);
+    }
+
+    result += kept_ends[i] - kept_begins[i];
+  }
+
+  targets[num_tiles] = result;
+
+  return max_distance;
+}
+
+
+// the number of elements to buffer per tile when shifting ranges of ValueType
+// no further than max_distance
+template<typename ValueType, typename Size>
+Size compacted_tiles_shift_buffer_size(Size max_distance)
+{
+  const Size capacity = static_cast<Size>((thrust::max)(compact_tiles_detail::buffer_bytes_per_tile / sizeof(ValueType), std::size_t(1)));
+
+  return (thrust::min)(capacity, max_distance);
+}
+
+
+// the passes of the shift, and the two steps of a pass for a single piece
+template<typename RandomAccessIterator, typename Size, typename BufferIterator>
+struct shift_compacted_tiles_pass
+{
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::is_convertible<
+      typename thrust::iterator_traversal<RandomAccessIterator>::type,
+      thrust::random_access_traversal_tag
+    >::value),
+    "the in-place compactions require random access iterators"
+  );
+
+  RandomAccessIterator first;
+  const Size *kept_begins;
+  const Size *targets;
+  Size num_tiles;
+  BufferIterator buffer;
+  Size buffer_size;
+
+  // the window written by this pass, split into num_tiles pieces of piece_size elements
+  Size window_begin;
+  Size window_end;
+  Size piece_size;
+
+  shift_compacted_tiles_pass(RandomAccessIterator first,
+                             const Size *kept_begins,
+                             const Size *targets,
+                             Size num_tiles,
+                             BufferIterator buffer,
+                             Size buffer_size)
+    : first(first), kept_begins(kept_begins), targets(targets), num_tiles(num_tiles),
+      buffer(buffer), buffer_size(buffer_size),
+      window_begin(0), window_end(0), piece_size(0)
+  {
+    // skip the ranges which stay where they are
+    for(Size i = 0; i < num_tiles && kept_begins[i] == targets[i]; ++i)
+    {
+      window_end = targets[i + 1];
+    }
+  }
+
+  // the distance the element written to output position p moves
+  Size distance(Size p) const
+  {
+    Size i = 0;
+    while(targets[i + 1] <= p)
+    {
+      ++i;
+    }
+
+    return kept_begins[i] - targets[i];
+  }
+
+  // the first output position whose element comes from source position s or after it
+  Size first_position_from(Size s) const
+  {
+    for(Size i = 0; i < num_tiles; ++i)
+    {
+      const Size length = targets[i + 1] - targets[i];
+
+      if(kept_begins[i] + length > s)
+      {
+        return targets[i] + (thrust::max)(Size(0), s - kept_begins[i]);
+      }
+    }
+
+    return targets[num_tiles];
+  }
+
+  // the first output position from which the distance exceeds the buffer
+  Size end_of_buffered_distances() const
+  {
+    for(Size i = 0; i < num_tiles; ++i)
+    {
+      if(targets[i] != targets[i + 1] && kept_begins[i] - targets[i] > buffer_size)
+      {
+        return targets[i];
+      }
+    }
+
+    return targets[num_tiles];
+  }
+
+  // moves to the next window, and returns false when the shift is done
+  bool next_window()
+  {
+    window_begin = window_end;
+
+    if(window_begin == targets[num_tiles])
+    {
+      return false;
+    }
+
+    const Size d = distance(window_begin);
+
+    if(d <= buffer_size)
+    {
+      // a piece buffers the elements landing on the later pieces, which come from the
+      // last d of its positions at most
+      window_end = end_of_buffered_distances();
+    }
+    else
+    {
+      // either the pieces are no larger than the buffer, or the window is no longer
+      // than the distance it moves, and no piece buffers anything
+      window_end = (thrust::min)(targets[num_tiles], window_begin + (thrust::max)(num_tiles * buffer_size, d));
+    }
+
+    const Size window_size = window_end - window_begin;
+    piece_size = (window_size + num_tiles - 1) / num_tiles;
+
+    return true;
+  }
+
+  // whether any piece of the window buffers any elements
+  bool buffers() const
+  {
+    return window_begin + distance(window_begin) < window_end;
+  }
+
+  Size piece_begin(Size k) const
+  {
+    return (thrust::min)(window_end, window_begin + k * piece_size);
+  }
+
+  // copies the elements which land on output positions [p_first, p_last) to result
+  template<typename OutputIterator>
+  OutputIterator gather(Size p_first, Size p_last, OutputIterator result) const
+  {
+    for(Size i = 0; i < num_tiles && p_first < p_last; ++i)
+    {
+      if(targets[i + 1] <= p_first)
+      {
+        continue;
+      }
+
+      const Size p_end = (thrust::min)(p_last, targets[i + 1]);
+
+      result = thrust::copy(thrust::seq,
+                            first + kept_begins[i] + (p_first - targets[i]),
+                            first + kept_begins[i] + (p_end - targets[i]),
+                            result);
+
+      p_first = p_end;
+    }
+
+    return result;
+  }
+
+  // the positions [buffered_begin, buffered_end) of piece k whose elements come from
+  // the later pieces of the window
+  void buffered_positions(Size k, Size &buffered_begin, Size &buffered_end) const
+  {
+    const Size p_first = piece_begin(k);
+    const Size p_last  = piece_begin(k + 1);
+
+    buffered_begin = (thrust::max)(p_first, first_position_from(p_last));
+    buffered_end   = (thrust::min)(p_last, first_position_from(window_end));
+    buffered_end   = (thrust::max)(buffered_begin, buffered_end);
+  }
+
+  void buffer_piece(Size k) const
+  {
+    Size buffered_begin, buffered_end;
+    buffered_positions(k, buffered_begin, buffered_end);
+
+    gather(buffered_begin, buffered_end, buffer + k * buffer_size);
+  }
+
+  // the elements before the buffered ones come from the piece itself, and are read
+  // ahead of where they are written; those after them come from past the window
+  void move_piece(Size k) const
+  {
+    Size buffered_begin, buffered_end;
+    buffered_positions(k, buffered_begin, buffered_end);
+
+    gather(piece_begin(k), buffered_begin, first + piece_begin(k));
+
+    thrust::copy(thrust::seq,
+                 buffer + k * buffer_size,
+                 buffer + k * buffer_size + (buffered_end - buffered_begin),
+                 first + buffered_begin);
+
+    gather(buffered_end, piece_begin(k + 1), first + buffered_end);
+  }
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,77 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file merge_path.h
+ *  \brief Merge path (co-rank) search shared by the partitioned merge-based
+ *         algorithms of the host parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/minmax.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// returns the number of elements of [keys1, keys1 + n1) which precede
+// output position diag in the stable merge of keys1 with [keys2, keys2 + n2);
+// the remaining diag - result elements are taken from keys2
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+Size merge_path(RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                Size n1,
+                Size n2,
+                Size diag,
+                StrictWeakOrdering comp)
+{
+  Size begin = thrust::max<Size>(0, diag - n2);
+  Size end   = thrust::min<Size>(diag, n1);
+
+  while(begin < end)
+  {
+    Size mid = begin + (end - begin) / 2;
+
+    // equivalent elements of keys1 precede those of keys2
+    if(comp(keys2[diag - 1 - mid], keys1[mid]))
+    {
+      end = mid;
+    }
+    else
+    {
+      begin = mid + 1;
+    }
+  }
+
+  return begin;
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
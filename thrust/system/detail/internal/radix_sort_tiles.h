@@ -0,0 +1,241 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file radix_sort_tiles.h
+ *  \brief Serial per-tile kernels shared by the parallel LSD radix sorts
+ *         of the host parallel backends.
+ *
+ *  Every pass of the sort sorts the keys by one radix digit, described by a
+ *  \p radix_pass, in three phases:
+ *    1. every tile counts its digits with \p radix_count_tile,
+ *    2. the counts are scanned serially into scatter offsets with \p radix_scan_counts,
+ *    3. every tile scatters its keys (and values) with \p radix_scatter_tile.
+ *
+ *  Tiles scatter in order and each tile scatters in order, so every pass is stable.
+ *  A sort by the bits [begin_bit, end_bit) of the keys runs one pass per digit
+ *  of that range, from the least significant one up.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// radix sorting applies to the same keys and orderings as the sequential primitive sort
+template<typename KeyType, typename Compare>
+struct use_radix_sort
+  : thrust::detail::and_<
+      thrust::detail::is_arithmetic<KeyType>,
+      thrust::detail::or_<
+        thrust::detail::is_same<Compare, thrust::less<KeyType> >,
+        thrust::detail::is_same<Compare, thrust::greater<KeyType> >
+      >
+    >
+{};
+
+
+template<typename KeyType, typename Compare>
+struct radix_sort_is_descending
+  : thrust::detail::is_same<Compare, thrust::greater<KeyType> >
+{};
+
+
+template<typename KeyType>
+struct radix_sort_traits
+{
+  typedef thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType> encoder_type;
+  typedef typename encoder_type::result_type                                            encoded_type;
+
+  static const unsigned int radix_bits  = 8;
+  static const unsigned int num_buckets = 1u << radix_bits;
+  static const unsigned int key_bits    = 8 * sizeof(encoded_type);
+  static const unsigned int num_passes  = (key_bits + (radix_bits - 1)) / radix_bits;
+};
+
+
+// the digit a pass sorts by: the bits of the encoded key at shift selected by mask
+struct radix_pass
+{
+  unsigned int shift;
+  unsigned int mask;
+};
+
+
+// returns the pass over the digit at shift of a sort by the bits below end_bit;
+// the last digit of the range is narrower when the range is not a whole number of digits
+template<typename KeyType>
+radix_pass make_radix_pass(unsigned int shift, unsigned int end_bit)
+{
+  typedef radix_sort_traits<KeyType> traits;
+
+  const unsigned int bits = end_bit - shift < traits::radix_bits ? end_bit - shift : traits::radix_bits;
+
+  radix_pass pass = {shift, (1u << bits) - 1};
+
+  return pass;
+}
+
+
+// returns the digit of key sorted by pass; a descending sort
+// reverses the order of the digits rather than that of the output,
+// which keeps equivalent keys in their original order
+template<bool Descending, typename KeyType>
+unsigned int radix_digit(const KeyType &key, radix_pass pass)
+{
+  typedef radix_sort_traits<KeyType> traits;
+
+  typename traits::encoder_type encode;
+
+  unsigned int digit = static_cast<unsigned int>((encode(key) >> pass.shift) & pass.mask);
+
+  return Descending ? pass.mask - digit : digit;
+}
+
+
+// counts the digits of [keys + begin, keys + end) into counts[0, num_buckets)
+template<bool Descending,
+         typename RandomAccessIterator,
+         typename Size>
+void radix_count_tile(RandomAccessIterator keys,
+                      Size begin,
+                      Size end,
+                      radix_pass pass,
+                      Size *counts)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  for(unsigned int bucket = 0; bucket < radix_sort_traits<KeyType>::num_buckets; ++bucket)
+  {
+    counts[bucket] = 0;
+  }
+
+  for(Size i = begin; i < end; ++i)
+  {
+    ++counts[radix_digit<Descending, KeyType>(keys[i], pass)];
+  }
+}
+
+
+// replaces the per-tile counts, stored tile-major, with the output position
+// of every tile's first key in each bucket; returns false if every key lies
+// in the same bucket, in which case the pass does not move any key
+template<unsigned int NumBuckets, typename Size>
+bool radix_scan_counts(Size *counts, Size num_tiles, Size n)
+{
+  bool pass_is_needed = true;
+
+  Size sum = 0;
+
+  for(unsigned int bucket = 0; bucket < NumBuckets; ++bucket)
+  {
+    Size bucket_first = sum;
+
+    for(Size tile = 0; tile < num_tiles; ++tile)
+    {
+      Size count = counts[tile * NumBuckets + bucket];
+      counts[tile * NumBuckets + bucket] = sum;
+      sum += count;
+    }
+
+    if(sum - bucket_first == n)
+    {
+      pass_is_needed = false;
+    }
+  }
+
+  return pass_is_needed;
+}
+
+
+// scatters [keys + begin, keys + end) to keys_result by digit, starting at offsets[0, num_buckets)
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size>
+void radix_scatter_tile(RandomAccessIterator1 keys,
+                        Size begin,
+                        Size end,
+                        radix_pass pass,
+                        const Size *offsets,
+                        RandomAccessIterator2 keys_result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  Size positions[radix_sort_traits<KeyType>::num_buckets];
+
+  for(unsigned int bucket = 0; bucket < radix_sort_traits<KeyType>::num_buckets; ++bucket)
+  {
+    positions[bucket] = offsets[bucket];
+  }
+
+  for(Size i = begin; i < end; ++i)
+  {
+    keys_result[positions[radix_digit<Descending, KeyType>(keys[i], pass)]++] = keys[i];
+  }
+}
+
+
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Size>
+void radix_scatter_by_key_tile(RandomAccessIterator1 keys,
+                               RandomAccessIterator2 values,
+                               Size begin,
+                               Size end,
+                               radix_pass pass,
+                               const Size *offsets,
+                               RandomAccessIterator3 keys_result,
+                               RandomAccessIterator4 values_result)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  Size positions[radix_sort_traits<KeyType>::num_buckets];
+
+  for(unsigned int bucket = 0; bucket < radix_sort_traits<KeyType>::num_buckets; ++bucket)
+  {
+    positions[bucket] = offsets[bucket];
+  }
+
+  for(Size i = begin; i < end; ++i)
+  {
+    Size position = positions[radix_digit<Descending, KeyType>(keys[i], pass)]++;
+
+    keys_result[position]   = keys[i];
+    values_result[position] = values[i];
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -0,0 +1,226 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file scan_by_key_tiles.h
+ *  \brief Serial per-tile kernels shared by the tiled scan_by_key
+ *         implementations of the host parallel backends.
+ *
+ *  A tiled segmented scan runs in three phases:
+ *    1. every tile is reduced to a (flag, value) carry with \p reduce_scan_by_key_tile,
+ *    2. the carries are scanned serially with \p propagate_scan_by_key_carries,
+ *    3. every tile is rescanned, seeded with its carry.
+ *
+ *  Keys are only read across a tile boundary during the first phase, so the
+ *  output may alias either input.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// the (flag, value) pair a tile hands to the tiles which follow it
+template<typename ValueType>
+struct scan_by_key_carry
+{
+  // the partial sum of the last segment of the tile; after
+  // propagate_scan_by_key_carries, the sum of the segment open on entry to the tile
+  ValueType sum;
+
+  // whether the first element of the tile begins a new segment
+  bool starts_segment;
+
+  // whether any element of the tile begins a new segment
+  bool has_head;
+};
+
+
+// reduces the last segment of [b, e) and records where segments begin;
+// when head_init is non-null, every segment's sum is seeded with *head_init
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename IndexType,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+scan_by_key_carry<ValueType> reduce_scan_by_key_tile(InputIterator1 keys,
+                                                     InputIterator2 values,
+                                                     IndexType b,
+                                                     IndexType e,
+                                                     const ValueType *head_init,
+                                                     BinaryPredicate binary_pred,
+                                                     BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_traits<InputIterator1>::value_type KeyType;
+
+  scan_by_key_carry<ValueType> carry;
+
+  KeyType prev_key = keys[b];
+
+  carry.starts_segment = (b == 0) || !binary_pred(keys[b - 1], prev_key);
+  carry.has_head       = carry.starts_segment;
+
+  ValueType sum = values[b];
+
+  if(carry.starts_segment && head_init)
+  {
+    sum = binary_op(*head_init, values[b]);
+  }
+
+  for(IndexType i = b + 1; i != e; ++i)
+  {
+    KeyType key = keys[i];
+
+    if(binary_pred(prev_key, key))
+    {
+      sum = binary_op(sum, values[i]);
+    }
+    else
+    {
+      carry.has_head = true;
+      sum = head_init ? ValueType(binary_op(*head_init, values[i])) : ValueType(values[i]);
+    }
+
+    prev_key = key;
+  }
+
+  carry.sum = sum;
+
+  return carry;
+}
+
+
+// turns the per-tile carries into the sum of the segment which is open on entry to each tile
+template<typename ValueType,
+         typename IndexType,
+         typename BinaryFunction>
+void propagate_scan_by_key_carries(scan_by_key_carry<ValueType> *carries,
+                                   IndexType num_tiles,
+                                   BinaryFunction binary_op)
+{
+  ValueType running = carries[0].sum;
+
+  for(IndexType i = 1; i < num_tiles; ++i)
+  {
+    ValueType tile_sum = carries[i].sum;
+
+    carries[i].sum = running;
+
+    running = carries[i].has_head ? tile_sum : ValueType(binary_op(running, tile_sum));
+  }
+}
+
+
+// inclusive segmented scan of [b, e), continuing the segment described by carry
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename IndexType,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+void inclusive_scan_by_key_tile(InputIterator1 keys,
+                                InputIterator2 values,
+                                OutputIterator result,
+                                IndexType b,
+                                IndexType e,
+                                const scan_by_key_carry<ValueType> &carry,
+                                BinaryPredicate binary_pred,
+                                BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_traits<InputIterator1>::value_type KeyType;
+
+  ValueType sum      = carry.sum;
+  KeyType   prev_key = keys[b];
+  bool      head     = carry.starts_segment;
+
+  for(IndexType i = b; i != e; ++i)
+  {
+    KeyType   key   = keys[i];
+    ValueType value = values[i];
+
+    if(i != b)
+    {
+      head = !binary_pred(prev_key, key);
+    }
+
+    sum = head ? value : ValueType(binary_op(sum, value));
+
+    result[i] = sum;
+
+    prev_key = key;
+  }
+}
+
+
+// exclusive segmented scan of [b, e), continuing the segment described by carry
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename IndexType,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+void exclusive_scan_by_key_tile(InputIterator1 keys,
+                                InputIterator2 values,
+                                OutputIterator result,
+                                IndexType b,
+                                IndexType e,
+                                const scan_by_key_carry<ValueType> &carry,
+                                const ValueType &init,
+                                BinaryPredicate binary_pred,
+                                BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_traits<InputIterator1>::value_type KeyType;
+
+  ValueType next     = carry.starts_segment ? init : carry.sum;
+  KeyType   prev_key = keys[b];
+
+  for(IndexType i = b; i != e; ++i)
+  {
+    KeyType key = keys[i];
+
+    // use temp to permit in-place scans
+    ValueType temp_value = values[i];
+
+    if(i != b && !binary_pred(prev_key, key))
+    {
+      next = init;  // reset sum
+    }
+
+    result[i] = next;
+    next = binary_op(next, temp_value);
+
+    prev_key = key;
+  }
+}
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
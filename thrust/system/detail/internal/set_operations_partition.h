@@ -0,0 +1,185 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file set_operations_partition.h
+ *  \brief Balanced path partitioning and serial kernels shared by the
+ *         partitioned set operations of the host parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/binary_search.h>
+#include <thrust/pair.h>
+#include <thrust/set_operations.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace internal
+{
+
+
+// returns the split of [keys1, keys1 + n1) and [keys2, keys2 + n2) nearest
+// to output position diag of their merge which never separates the k-th
+// occurrence of an element in keys1 from the k-th equivalent occurrence in
+// keys2, so that a set operation of the two inputs is the concatenation of
+// the set operations of the pieces on either side of the split
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Size,
+         typename StrictWeakOrdering>
+thrust::pair<Size,Size> balanced_path(RandomAccessIterator1 keys1,
+                                      RandomAccessIterator2 keys2,
+                                      Size n1,
+                                      Size n2,
+                                      Size diag,
+                                      StrictWeakOrdering comp)
+{
+  Size i = merge_path(keys1, keys2, n1, n2, diag, comp);
+  Size j = diag - i;
+
+  if(i == n1 && j == n2)
+  {
+    return thrust::make_pair(n1, n2);
+  }
+
+  // find the run of elements equivalent to the one which follows the split
+  // in both inputs; elements of keys1 precede equivalent elements of keys2
+  // on the merge path, so the run ends at i in keys1 or begins at j in keys2
+  Size lo1, hi1, lo2, hi2;
+
+  if(i < n1 && (j == n2 || !comp(keys2[j], keys1[i])))
+  {
+    lo1 = thrust::lower_bound(thrust::seq, keys1, keys1 + i, thrust::raw_reference_cast(keys1[i]), comp) - keys1;
+    hi1 = thrust::upper_bound(thrust::seq, keys1 + i, keys1 + n1, thrust::raw_reference_cast(keys1[i]), comp) - keys1;
+    lo2 = j;
+    hi2 = thrust::upper_bound(thrust::seq, keys2 + j, keys2 + n2, thrust::raw_reference_cast(keys1[i]), comp) - keys2;
+  }
+  else
+  {
+    lo1 = thrust::lower_bound(thrust::seq, keys1, keys1 + i, thrust::raw_reference_cast(keys2[j]), comp) - keys1;
+    hi1 = i;
+    lo2 = thrust::lower_bound(thrust::seq, keys2, keys2 + j, thrust::raw_reference_cast(keys2[j]), comp) - keys2;
+    hi2 = thrust::upper_bound(thrust::seq, keys2 + j, keys2 + n2, thrust::raw_reference_cast(keys2[j]), comp) - keys2;
+  }
+
+  // the number of elements of the run on the left of the merge path split
+  Size run_left = (i - lo1) + (j - lo2);
+
+  // the number of occurrences of the run which have a partner in the other input
+  Size matched = thrust::min<Size>(hi1 - lo1, hi2 - lo2);
+
+  Size left1, left2;
+
+  if(run_left <= 2 * matched)
+  {
+    // split the matched occurrences in pairs
+    left1 = left2 = run_left / 2;
+  }
+  else if(hi1 - lo1 > matched)
+  {
+    // keep every matched pair on the left, split the unmatched tail of keys1
+    left2 = matched;
+    left1 = run_left - matched;
+  }
+  else
+  {
+    // keep every matched pair on the left, split the unmatched tail of keys2
+    left1 = matched;
+    left2 = run_left - matched;
+  }
+
+  return thrust::make_pair(lo1 + left1, lo2 + left2);
+}
+
+
+struct serial_set_difference
+{
+  template<typename InputIterator1,
+           typename InputIterator2,
+           typename OutputIterator,
+           typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_intersection
+{
+  template<typename InputIterator1,
+           typename InputIterator2,
+           typename OutputIterator,
+           typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_symmetric_difference
+{
+  template<typename InputIterator1,
+           typename InputIterator2,
+           typename OutputIterator,
+           typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+struct serial_set_union
+{
+  template<typename InputIterator1,
+           typename InputIterator2,
+           typename OutputIterator,
+           typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1, InputIterator1 last1,
+                            InputIterator2 first2, InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+
+} // end namespace internal
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -0,0 +1,354 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file galloping_search.h
+ *  \brief Galloping (exponential) search used by the sequential merge and
+ *         set operation loops to skip long runs taken from one input.
+ *
+ *  The loops compare the heads of their two inputs one element at a time, as
+ *  before, and count how many consecutive elements come from the same input.
+ *  Once the count reaches \p gallop_counter::min_run, the end of the run is
+ *  found with an exponential search from the head of that input followed by a
+ *  binary search, and the whole run is copied (or skipped) at once. This costs
+ *  O(log k) comparisons for a run of k elements instead of O(k), which pays off
+ *  when the inputs differ a lot in size or interleave in long runs.
+ *
+ *  Galloping needs random access to the inputs; with other iterators the
+ *  loops never gallop.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace galloping_search_detail
+{
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator gallop_lower_bound(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T &value,
+                                        StrictWeakOrdering comp,
+                                        thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // probe first[0], first[1], first[3], first[7], ... until an element is not less than value
+  difference_type lo = 0;
+  difference_type hi = 1;
+
+  while(hi <= n && comp(first[hi - 1], value))
+  {
+    lo = hi;
+    hi = 2 * hi;
+  }
+
+  if(hi > n)
+  {
+    hi = n;
+  }
+
+  // the answer lies in [lo, hi]
+  first += lo;
+  difference_type len = hi - lo;
+
+  while(len > 0)
+  {
+    difference_type half = len >> 1;
+
+    if(comp(first[half], value))
+    {
+      first += half + 1;
+      len = len - half - 1;
+    }
+    else
+    {
+      len = half;
+    }
+  }
+
+  return first;
+}
+
+
+__thrust_exec_check_disable__
+template<typename RandomAccessIterator,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator gallop_upper_bound(RandomAccessIterator first,
+                                        RandomAccessIterator last,
+                                        const T &value,
+                                        StrictWeakOrdering comp,
+                                        thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  const difference_type n = last - first;
+
+  // probe first[0], first[1], first[3], first[7], ... until an element is greater than value
+  difference_type lo = 0;
+  difference_type hi = 1;
+
+  while(hi <= n && !comp(value, first[hi - 1]))
+  {
+    lo = hi;
+    hi = 2 * hi;
+  }
+
+  if(hi > n)
+  {
+    hi = n;
+  }
+
+  // the answer lies in [lo, hi]
+  first += lo;
+  difference_type len = hi - lo;
+
+  while(len > 0)
+  {
+    difference_type half = len >> 1;
+
+    if(!comp(value, first[half]))
+    {
+      first += half + 1;
+      len = len - half - 1;
+    }
+    else
+    {
+      len = half;
+    }
+  }
+
+  return first;
+}
+
+
+// iterators without random access never gallop
+template<typename Iterator,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+Iterator gallop_lower_bound(Iterator first,
+                            Iterator,
+                            const T &,
+                            StrictWeakOrdering,
+                            thrust::incrementable_traversal_tag)
+{
+  return first;
+}
+
+
+template<typename Iterator,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+Iterator gallop_upper_bound(Iterator first,
+                            Iterator,
+                            const T &,
+                            StrictWeakOrdering,
+                            thrust::incrementable_traversal_tag)
+{
+  return first;
+}
+
+
+} // end namespace galloping_search_detail
+
+
+template<typename Iterator1, typename Iterator2>
+struct can_gallop
+  : thrust::detail::and_<
+      thrust::detail::is_convertible<
+        typename thrust::iterator_traversal<Iterator1>::type,
+        thrust::random_access_traversal_tag
+      >,
+      thrust::detail::is_convertible<
+        typename thrust::iterator_traversal<Iterator2>::type,
+        thrust::random_access_traversal_tag
+      >
+    >
+{};
+
+
+// returns the first position in [first, last) whose element is not less than value
+template<typename Iterator,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+Iterator gallop_lower_bound(Iterator first,
+                            Iterator last,
+                            const T &value,
+                            StrictWeakOrdering comp)
+{
+  return galloping_search_detail::gallop_lower_bound(first, last, value, comp,
+    typename thrust::iterator_traversal<Iterator>::type());
+}
+
+
+// returns the first position in [first, last) whose element is greater than value
+template<typename Iterator,
+         typename T,
+         typename StrictWeakOrdering>
+__host__ __device__
+Iterator gallop_upper_bound(Iterator first,
+                            Iterator last,
+                            const T &value,
+                            StrictWeakOrdering comp)
+{
+  return galloping_search_detail::gallop_upper_bound(first, last, value, comp,
+    typename thrust::iterator_traversal<Iterator>::type());
+}
+
+
+// counts the consecutive elements a merge-like loop takes from each of its
+// inputs and tells it when to gallop; a min_run of zero disables galloping
+struct gallop_counter
+{
+  // the length of a run which switches the loop to galloping
+  static const int min_run_default = 7;
+
+  // when one input is this many times longer than the other, its elements
+  // come in long runs between consecutive elements of the shorter input
+  static const int skew = 8;
+
+  int min_run;
+  int run1;
+  int run2;
+
+  __host__ __device__
+  explicit gallop_counter(int min_run)
+    : min_run(min_run), run1(0), run2(0)
+  {}
+
+  // an element was taken from the first input; returns true if the loop should gallop through it
+  __host__ __device__
+  bool step1()
+  {
+    run2 = 0;
+
+    if(min_run == 0 || ++run1 < min_run)
+    {
+      return false;
+    }
+
+    run1 = 0;
+    return true;
+  }
+
+  // an element was taken from the second input; returns true if the loop should gallop through it
+  __host__ __device__
+  bool step2()
+  {
+    run1 = 0;
+
+    if(min_run == 0 || ++run2 < min_run)
+    {
+      return false;
+    }
+
+    run2 = 0;
+    return true;
+  }
+
+  // an element was taken from both inputs
+  __host__ __device__
+  void reset()
+  {
+    run1 = 0;
+    run2 = 0;
+  }
+};
+
+
+namespace galloping_search_detail
+{
+
+
+template<typename Iterator1, typename Iterator2>
+__host__ __device__
+gallop_counter make_gallop_counter(Iterator1 first1,
+                                   Iterator1 last1,
+                                   Iterator2 first2,
+                                   Iterator2 last2,
+                                   thrust::detail::true_type) // can_gallop
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type difference_type1;
+  typedef typename thrust::iterator_difference<Iterator2>::type difference_type2;
+
+  const difference_type1 n1 = last1 - first1;
+  const difference_type2 n2 = last2 - first2;
+
+  // gallop from the start when the sizes are skewed
+  const bool skewed = n1 / gallop_counter::skew > n2 || n2 / gallop_counter::skew > n1;
+
+  return gallop_counter(skewed ? 1 : gallop_counter::min_run_default);
+}
+
+
+template<typename Iterator1, typename Iterator2>
+__host__ __device__
+gallop_counter make_gallop_counter(Iterator1,
+                                   Iterator1,
+                                   Iterator2,
+                                   Iterator2,
+                                   thrust::detail::false_type) // can_gallop
+{
+  return gallop_counter(0);
+}
+
+
+} // end namespace galloping_search_detail
+
+
+// returns a gallop_counter for a loop over [first1, last1) and [first2, last2);
+// CanGallop may further restrict galloping, e.g. to inputs whose values are random access too
+template<typename CanGallop = thrust::detail::true_type,
+         typename Iterator1,
+         typename Iterator2>
+__host__ __device__
+gallop_counter make_gallop_counter(Iterator1 first1,
+                                   Iterator1 last1,
+                                   Iterator2 first2,
+                                   Iterator2 last2)
+{
+  return galloping_search_detail::make_gallop_counter(first1, last1, first2, last2,
+    typename thrust::detail::and_<CanGallop, can_gallop<Iterator1,Iterator2> >::type());
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
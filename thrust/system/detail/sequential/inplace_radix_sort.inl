@@ -0,0 +1,367 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file inplace_radix_sort.inl
+ *  \brief An unstable, in-place MSD radix sort ("American flag sort").
+ *
+ *  Every level of the sort counts the keys by one byte of their encoding,
+ *  most significant byte first, and swaps them into their buckets in place.
+ *  Every bucket is then sorted by the next byte. Small buckets are finished
+ *  with an insertion sort.
+ *
+ *  Unlike the LSD sort in stable_radix_sort.inl, which needs a second copy of
+ *  the keys and values, the only extra storage is two 256-entry tables per
+ *  level, and there are at most sizeof(KeyType) levels.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/detail/sequential/inplace_radix_sort.h>
+#include <thrust/system/detail/sequential/insertion_sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/type_traits.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace detail
+{
+namespace sequential
+{
+namespace inplace_radix_sort_detail
+{
+
+
+// buckets of at most this many keys are insertion sorted
+const size_t insertion_sort_threshold = 64;
+
+
+template<typename KeyType>
+struct radix_traits
+{
+  typedef radix_sort_detail::RadixEncoder<KeyType> Encoder;
+  typedef typename Encoder::result_type            EncodedType;
+
+  static const unsigned int RadixBits  = 8;
+  static const unsigned int NumBuckets = 1 << RadixBits;
+};
+
+
+// orders keys by their encoding, which is the order the radix passes sort them in
+template<typename KeyType>
+struct encoded_less
+{
+  typedef typename radix_traits<KeyType>::Encoder     Encoder;
+  typedef typename radix_traits<KeyType>::EncodedType EncodedType;
+
+  __host__ __device__
+  bool operator()(const KeyType &lhs, const KeyType &rhs) const
+  {
+    Encoder encode;
+
+    return static_cast<EncodedType>(encode(lhs)) < static_cast<EncodedType>(encode(rhs));
+  }
+};
+
+
+template<typename KeyType>
+__host__ __device__
+unsigned int digit(const KeyType &key, unsigned int shift)
+{
+  typedef radix_traits<KeyType> traits;
+
+  typename traits::Encoder encode;
+
+  const typename traits::EncodedType x = static_cast<typename traits::EncodedType>(encode(key));
+
+  return static_cast<unsigned int>((x >> shift) & (traits::NumBuckets - 1));
+}
+
+
+// moves every key into its bucket; [heads[i], tails[i]) are the slots of
+// bucket i which have not been filled yet. Every key in those slots is swapped
+// into the next free slot of its own bucket, which fills that slot for good.
+// The key swapped back is looked at in the next sweep, so consecutive swaps
+// do not depend on each other as they would when following a cycle
+template<typename RandomAccessIterator>
+__host__ __device__
+void permute(RandomAccessIterator keys,
+             size_t *heads,
+             const size_t *tails,
+             unsigned int shift)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  bool done = false;
+
+  while(!done)
+  {
+    done = true;
+
+    for(unsigned int bucket = 0; bucket < radix_traits<KeyType>::NumBuckets; ++bucket)
+    {
+      const size_t end = tails[bucket];
+
+      for(size_t i = heads[bucket]; i < end; ++i)
+      {
+        const size_t position = heads[digit<KeyType>(keys[i], shift)]++;
+
+        KeyType tmp = keys[position];
+        keys[position] = keys[i];
+        keys[i] = tmp;
+      }
+
+      done = done && heads[bucket] == end;
+    }
+  }
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void permute_by_key(RandomAccessIterator1 keys,
+                    RandomAccessIterator2 vals,
+                    size_t *heads,
+                    const size_t *tails,
+                    unsigned int shift)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+
+  bool done = false;
+
+  while(!done)
+  {
+    done = true;
+
+    for(unsigned int bucket = 0; bucket < radix_traits<KeyType>::NumBuckets; ++bucket)
+    {
+      const size_t end = tails[bucket];
+
+      for(size_t i = heads[bucket]; i < end; ++i)
+      {
+        const size_t position = heads[digit<KeyType>(keys[i], shift)]++;
+
+        KeyType tmp_key = keys[position];
+        keys[position] = keys[i];
+        keys[i] = tmp_key;
+
+        ValueType tmp_val = vals[position];
+        vals[position] = vals[i];
+        vals[i] = tmp_val;
+      }
+
+      done = done && heads[bucket] == end;
+    }
+  }
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void permute_bucket(RandomAccessIterator1 keys,
+                    RandomAccessIterator2,
+                    size_t *heads,
+                    const size_t *tails,
+                    unsigned int shift,
+                    thrust::detail::false_type) // HasValues
+{
+  permute(keys, heads, tails, shift);
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void permute_bucket(RandomAccessIterator1 keys,
+                    RandomAccessIterator2 vals,
+                    size_t *heads,
+                    const size_t *tails,
+                    unsigned int shift,
+                    thrust::detail::true_type) // HasValues
+{
+  permute_by_key(keys, vals, heads, tails, shift);
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void insertion_sort_bucket(RandomAccessIterator1 keys,
+                           RandomAccessIterator2,
+                           const size_t N,
+                           thrust::detail::false_type) // HasValues
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  sequential::insertion_sort(keys, keys + N, encoded_less<KeyType>());
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void insertion_sort_bucket(RandomAccessIterator1 keys,
+                           RandomAccessIterator2 vals,
+                           const size_t N,
+                           thrust::detail::true_type) // HasValues
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  sequential::insertion_sort_by_key(keys, keys + N, vals, encoded_less<KeyType>());
+}
+
+
+// sorts [keys, keys + N) by the bytes at shift and below
+template<typename HasValues,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void american_flag_sort(RandomAccessIterator1 keys,
+                        RandomAccessIterator2 vals,
+                        const size_t N,
+                        unsigned int shift)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef radix_traits<KeyType>                                         traits;
+
+  const unsigned int NumBuckets = traits::NumBuckets;
+
+  size_t heads[NumBuckets];
+  size_t tails[NumBuckets];
+
+  for(;;)
+  {
+    if(N <= insertion_sort_threshold)
+    {
+      insertion_sort_bucket(keys, vals, N, HasValues());
+      return;
+    }
+
+    for(unsigned int bucket = 0; bucket < NumBuckets; ++bucket)
+    {
+      heads[bucket] = 0;
+    }
+
+    for(size_t i = 0; i < N; ++i)
+    {
+      ++heads[digit<KeyType>(keys[i], shift)];
+    }
+
+    // a byte shared by every key moves nothing, so go straight to the next one
+    if(heads[digit<KeyType>(keys[0], shift)] != N)
+    {
+      break;
+    }
+
+    if(shift == 0)
+    {
+      return;
+    }
+
+    shift -= traits::RadixBits;
+  }
+
+  // turn the counts into the ranges [heads[i], tails[i])
+  size_t sum = 0;
+
+  for(unsigned int bucket = 0; bucket < NumBuckets; ++bucket)
+  {
+    const size_t count = heads[bucket];
+    heads[bucket] = sum;
+    sum += count;
+    tails[bucket] = sum;
+  }
+
+  permute_bucket(keys, vals, heads, tails, shift, HasValues());
+
+  if(shift == 0)
+  {
+    return;
+  }
+
+  // sort every bucket by the next byte
+  size_t bucket_begin = 0;
+
+  for(unsigned int bucket = 0; bucket < NumBuckets; ++bucket)
+  {
+    const size_t bucket_size = tails[bucket] - bucket_begin;
+
+    if(bucket_size > 1)
+    {
+      american_flag_sort<HasValues>(keys + bucket_begin, vals + bucket_begin, bucket_size, shift - traits::RadixBits);
+    }
+
+    bucket_begin = tails[bucket];
+  }
+}
+
+
+} // end namespace inplace_radix_sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+void inplace_radix_sort(sequential::execution_policy<DerivedPolicy> &,
+                        RandomAccessIterator first,
+                        RandomAccessIterator last)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+  typedef inplace_radix_sort_detail::radix_traits<KeyType>             traits;
+
+  const size_t N = last - first;
+
+  if(N < 2) return;
+
+  const unsigned int most_significant_shift = 8 * sizeof(typename traits::EncodedType) - traits::RadixBits;
+
+  // the keys stand in for the values, which are never accessed
+  inplace_radix_sort_detail::american_flag_sort<thrust::detail::false_type>(first, first, N, most_significant_shift);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void inplace_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &,
+                               RandomAccessIterator1 first1,
+                               RandomAccessIterator1 last1,
+                               RandomAccessIterator2 first2)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef inplace_radix_sort_detail::radix_traits<KeyType>              traits;
+
+  const size_t N = last1 - first1;
+
+  if(N < 2) return;
+
+  const unsigned int most_significant_shift = 8 * sizeof(typename traits::EncodedType) - traits::RadixBits;
+
+  inplace_radix_sort_detail::american_flag_sort<thrust::detail::true_type>(first1, first2, N, most_significant_shift);
+}
+
+
+} // end namespace sequential
+} // end namespace detail
+} // end namespace system
+THRUST_NAMESPACE_END
+
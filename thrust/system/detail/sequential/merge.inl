@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,6 +19,9 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/detail/sequential/merge.h>
+#include <thrust/system/detail/sequential/galloping_search.h>
+#include <thrust/advance.h>
+#include <thrust/distance.h>
 #include <thrust/detail/copy.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
@@ -52,20 +56,38 @@ OutputIterator merge(sequential::execution_policy<DerivedPolicy> &exec,
     bool
   > wrapped_comp(comp);
 
+  sequential::gallop_counter gallop = sequential::make_gallop_counter(first1, last1, first2, last2);
+
   while(first1 != last1 && first2 != last2)
   {
     if(wrapped_comp(*first2, *first1))
     {
       *result = *first2;
       ++first2;
+      ++result;
+
+      if(gallop.step2())
+      {
+        // copy the rest of the elements less than *first1 at once
+        InputIterator2 mid = sequential::gallop_lower_bound(first2, last2, *first1, wrapped_comp);
+        result = thrust::copy(exec, first2, mid, result);
+        first2 = mid;
+      } // end if
     } // end if
     else
     {
       *result = *first1;
       ++first1;
+      ++result;
+
+      if(gallop.step1())
+      {
+        // copy the rest of the elements not greater than *first2 at once
+        InputIterator1 mid = sequential::gallop_upper_bound(first1, last1, *first2, wrapped_comp);
+        result = thrust::copy(exec, first1, mid, result);
+        first1 = mid;
+      } // end if
     } // end else
-
-    ++result;
   } // end while
 
   return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
@@ -83,7 +105,7 @@ template<typename DerivedPolicy,
          typename StrictWeakOrdering>
 __host__ __device__
 thrust::pair<OutputIterator1,OutputIterator2>
-  merge_by_key(sequential::execution_policy<DerivedPolicy> &,
+  merge_by_key(sequential::execution_policy<DerivedPolicy> &exec,
                InputIterator1 keys_first1,
                InputIterator1 keys_last1,
                InputIterator2 keys_first2,
@@ -100,6 +122,12 @@ thrust::pair<OutputIterator1,OutputIterator2>
     bool
   > wrapped_comp(comp);
 
+  // runs of values are copied along with their keys, so the values need random access too
+  sequential::gallop_counter gallop =
+    sequential::make_gallop_counter<
+      sequential::can_gallop<InputIterator3,InputIterator4>
+    >(keys_first1, keys_last1, keys_first2, keys_last2);
+
   while(keys_first1 != keys_last1 && keys_first2 != keys_last2)
   {
     if(!wrapped_comp(*keys_first2, *keys_first1))
@@ -109,6 +137,20 @@ thrust::pair<OutputIterator1,OutputIterator2>
       *values_result = *values_first1;
       ++keys_first1;
       ++values_first1;
+      ++keys_result;
+      ++values_result;
+
+      if(gallop.step1())
+      {
+        // copy the rest of the keys not greater than *keys_first2 at once
+        InputIterator1 mid = sequential::gallop_upper_bound(keys_first1, keys_last1, *keys_first2, wrapped_comp);
+        typename thrust::iterator_difference<InputIterator1>::type n = thrust::distance(keys_first1, mid);
+
+        keys_result   = thrust::copy(exec, keys_first1, mid, keys_result);
+        values_result = thrust::copy_n(exec, values_first1, n, values_result);
+        keys_first1   = mid;
+        thrust::advance(values_first1, n);
+      }
     }
     else
     {
@@ -117,10 +159,21 @@ thrust::pair<OutputIterator1,OutputIterator2>
       *values_result = *values_first2;
       ++keys_first2;
       ++values_first2;
+      ++keys_result;
+      ++values_result;
+
+      if(gallop.step2())
+      {
+        // copy the rest of the keys less than *keys_first1 at once
+        InputIterator2 mid = sequential::gallop_lower_bound(keys_first2, keys_last2, *keys_first1, wrapped_comp);
+        typename thrust::iterator_difference<InputIterator2>::type n = thrust::distance(keys_first2, mid);
+
+        keys_result   = thrust::copy(exec, keys_first2, mid, keys_result);
+        values_result = thrust::copy_n(exec, values_first2, n, values_result);
+        keys_first2   = mid;
+        thrust::advance(values_first2, n);
+      }
     }
-
-    ++keys_result;
-    ++values_result;
   }
 
   while(keys_first1 != keys_last1)
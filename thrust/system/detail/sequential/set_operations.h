@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -23,6 +24,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/galloping_search.h>
 #include <thrust/detail/copy.h>
 #include <thrust/detail/function.h>
 
@@ -56,6 +58,8 @@ __host__ __device__
     bool
   > wrapped_comp(comp);
 
+  sequential::gallop_counter gallop = sequential::make_gallop_counter(first1, last1, first2, last2);
+
   while(first1 != last1 && first2 != last2)
   {
     if(wrapped_comp(*first1,*first2))
@@ -63,15 +67,30 @@ __host__ __device__
       *result = *first1;
       ++first1;
       ++result;
+
+      if(gallop.step1())
+      {
+        // copy the rest of the elements less than *first2 at once
+        InputIterator1 mid = sequential::gallop_lower_bound(first1, last1, *first2, wrapped_comp);
+        result = thrust::copy(exec, first1, mid, result);
+        first1 = mid;
+      } // end if
     } // end if
     else if(wrapped_comp(*first2,*first1))
     {
       ++first2;
+
+      if(gallop.step2())
+      {
+        // skip the rest of the elements less than *first1 at once
+        first2 = sequential::gallop_lower_bound(first2, last2, *first1, wrapped_comp);
+      } // end if
     } // end else if
     else
     {
       ++first1;
       ++first2;
+      gallop.reset();
     } // end else
   } // end while
 
@@ -100,15 +119,29 @@ __host__ __device__
     bool
   > wrapped_comp(comp);
 
+  sequential::gallop_counter gallop = sequential::make_gallop_counter(first1, last1, first2, last2);
+
   while(first1 != last1 && first2 != last2)
   {
     if(wrapped_comp(*first1,*first2))
     {
       ++first1;
+
+      if(gallop.step1())
+      {
+        // skip the rest of the elements less than *first2 at once
+        first1 = sequential::gallop_lower_bound(first1, last1, *first2, wrapped_comp);
+      } // end if
     } // end if
     else if(wrapped_comp(*first2,*first1))
     {
       ++first2;
+
+      if(gallop.step2())
+      {
+        // skip the rest of the elements less than *first1 at once
+        first2 = sequential::gallop_lower_bound(first2, last2, *first1, wrapped_comp);
+      } // end if
     } // end else if
     else
     {
@@ -116,6 +149,7 @@ __host__ __device__
       ++first1;
       ++first2;
       ++result;
+      gallop.reset();
     } // end else
   } // end while
 
@@ -144,6 +178,8 @@ __host__ __device__
     bool
   > wrapped_comp(comp);
 
+  sequential::gallop_counter gallop = sequential::make_gallop_counter(first1, last1, first2, last2);
+
   while(first1 != last1 && first2 != last2)
   {
     if(wrapped_comp(*first1,*first2))
@@ -151,17 +187,34 @@ __host__ __device__
       *result = *first1;
       ++first1;
       ++result;
+
+      if(gallop.step1())
+      {
+        // copy the rest of the elements less than *first2 at once
+        InputIterator1 mid = sequential::gallop_lower_bound(first1, last1, *first2, wrapped_comp);
+        result = thrust::copy(exec, first1, mid, result);
+        first1 = mid;
+      } // end if
     } // end if
     else if(wrapped_comp(*first2,*first1))
     {
       *result = *first2;
       ++first2;
       ++result;
+
+      if(gallop.step2())
+      {
+        // copy the rest of the elements less than *first1 at once
+        InputIterator2 mid = sequential::gallop_lower_bound(first2, last2, *first1, wrapped_comp);
+        result = thrust::copy(exec, first2, mid, result);
+        first2 = mid;
+      } // end if
     } // end else if
     else
     {
       ++first1;
       ++first2;
+      gallop.reset();
     } // end else
   } // end while
 
@@ -190,26 +243,46 @@ __host__ __device__
     bool
   > wrapped_comp(comp);
 
+  sequential::gallop_counter gallop = sequential::make_gallop_counter(first1, last1, first2, last2);
+
   while(first1 != last1 && first2 != last2)
   {
     if(wrapped_comp(*first1,*first2))
     {
       *result = *first1;
       ++first1;
+      ++result;
+
+      if(gallop.step1())
+      {
+        // copy the rest of the elements less than *first2 at once
+        InputIterator1 mid = sequential::gallop_lower_bound(first1, last1, *first2, wrapped_comp);
+        result = thrust::copy(exec, first1, mid, result);
+        first1 = mid;
+      } // end if
     } // end if
     else if(wrapped_comp(*first2,*first1))
     {
       *result = *first2;
       ++first2;
+      ++result;
+
+      if(gallop.step2())
+      {
+        // copy the rest of the elements less than *first1 at once
+        InputIterator2 mid = sequential::gallop_lower_bound(first2, last2, *first1, wrapped_comp);
+        result = thrust::copy(exec, first2, mid, result);
+        first2 = mid;
+      } // end if
     } // end else if
     else
     {
       *result = *first1;
       ++first1;
       ++first2;
+      ++result;
+      gallop.reset();
     } // end else
-
-    ++result;
   } // end while
 
   return thrust::copy(exec, first2, last2, thrust::copy(exec, first1, last1, result));
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -32,6 +33,50 @@ namespace sequential
 {
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort(sequential::execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 first1,
+                 RandomAccessIterator1 last1,
+                 RandomAccessIterator2 first2,
+                 StrictWeakOrdering comp);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+void sort(sequential::execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          unsigned int begin_bit,
+          unsigned int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 first1,
+                 RandomAccessIterator1 last1,
+                 RandomAccessIterator2 first2,
+                 unsigned int begin_bit,
+                 unsigned int end_bit);
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
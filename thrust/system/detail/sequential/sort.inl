@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2021 NVIDIA Corporation
- *  Modifications Copyright© 2019-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -22,8 +22,12 @@
 #include <thrust/reverse.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/type_traits/radix_key_decomposer.h>
+#include <thrust/system/detail/sequential/inplace_radix_sort.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+#include <thrust/detail/static_assert.h>
 
 #include <thrust/detail/nv_target.h>
 
@@ -62,11 +66,18 @@ void stable_sort(sequential::execution_policy<DerivedPolicy> &exec,
                  StrictWeakOrdering,
                  thrust::detail::true_type)
 {
-  thrust::system::detail::sequential::stable_primitive_sort(exec, first, last);
-
   // if comp is greater<T> then reverse the keys
   typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
 
+  // equivalent composite keys may differ, so we also have to reverse
+  // the (unordered) input of a composite key to preserve stability
+  if(needs_reverse<KeyType,StrictWeakOrdering>::value && !thrust::detail::is_arithmetic<KeyType>::value)
+  {
+    thrust::reverse(exec, first, last);
+  }
+
+  thrust::system::detail::sequential::stable_primitive_sort(exec, first, last);
+
   if(needs_reverse<KeyType,StrictWeakOrdering>::value)
   {
     thrust::reverse(exec, first, last);
@@ -141,8 +152,26 @@ void stable_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
 }
 
 
+// keys decomposed by radix_key_decomposer are radix sorted field by field
 template<typename KeyType, typename Compare>
 struct use_primitive_sort
+  : thrust::detail::and_<
+      thrust::detail::or_<
+        thrust::detail::is_arithmetic<KeyType>,
+        thrust::is_radix_key_decomposable<KeyType>
+      >,
+      thrust::detail::or_<
+        thrust::detail::is_same<Compare, thrust::less<KeyType> >,
+        thrust::detail::is_same<Compare, thrust::greater<KeyType> >
+      >
+    >
+{};
+
+
+// sort and sort_by_key need not be stable, so arithmetic keys are radix sorted
+// in place instead of through the double buffer of stable_primitive_sort
+template<typename KeyType, typename Compare>
+struct use_inplace_radix_sort
   : thrust::detail::and_<
       thrust::detail::is_arithmetic<KeyType>,
       thrust::detail::or_<
@@ -153,6 +182,82 @@ struct use_primitive_sort
 {};
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort(sequential::execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering,
+          thrust::detail::true_type)
+{
+  typedef typename thrust::iterator_traits<RandomAccessIterator>::value_type KeyType;
+
+  thrust::system::detail::sequential::inplace_radix_sort(exec, first, last);
+
+  // if comp is greater<T> then reverse the keys; equivalent keys may end up in any order
+  if(needs_reverse<KeyType,StrictWeakOrdering>::value)
+  {
+    thrust::reverse(exec, first, last);
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 first1,
+                 RandomAccessIterator1 last1,
+                 RandomAccessIterator2 first2,
+                 StrictWeakOrdering,
+                 thrust::detail::true_type)
+{
+  typedef typename thrust::iterator_traits<RandomAccessIterator1>::value_type KeyType;
+
+  thrust::system::detail::sequential::inplace_radix_sort_by_key(exec, first1, last1, first2);
+
+  if(needs_reverse<KeyType,StrictWeakOrdering>::value)
+  {
+    thrust::reverse(exec, first1,  last1);
+    thrust::reverse(exec, first2, first2 + (last1 - first1));
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort(sequential::execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp,
+          thrust::detail::false_type)
+{
+  thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 first1,
+                 RandomAccessIterator1 last1,
+                 RandomAccessIterator2 first2,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
+{
+  thrust::system::detail::sequential::stable_sort_by_key(exec, first1, last1, first2, comp);
+}
+
+
 } // end namespace sort_detail
 
 
@@ -202,6 +307,104 @@ void stable_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
 }
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort(sequential::execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp)
+{
+  // the device path keeps the merge sort of stable_sort, which does not recurse
+  NV_IF_TARGET(NV_IS_HOST, (
+    using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
+    sort_detail::use_inplace_radix_sort<KeyType, StrictWeakOrdering> use_inplace_radix_sort;
+    sort_detail::sort(exec, first, last, comp, use_inplace_radix_sort);
+  ), ( // NV_IS_DEVICE:
+    thrust::detail::false_type use_inplace_radix_sort;
+    sort_detail::sort(exec, first, last, comp, use_inplace_radix_sort);
+  ));
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+void sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 first1,
+                 RandomAccessIterator1 last1,
+                 RandomAccessIterator2 first2,
+                 StrictWeakOrdering comp)
+{
+  // the device path keeps the merge sort of stable_sort_by_key, which does not recurse
+  NV_IF_TARGET(NV_IS_HOST, (
+    using KeyType = thrust::iterator_value_t<RandomAccessIterator1>;
+    sort_detail::use_inplace_radix_sort<KeyType, StrictWeakOrdering> use_inplace_radix_sort;
+    sort_detail::sort_by_key(exec, first1, last1, first2, comp, use_inplace_radix_sort);
+  ), ( // NV_IS_DEVICE:
+    thrust::detail::false_type use_inplace_radix_sort;
+    sort_detail::sort_by_key(exec, first1, last1, first2, comp, use_inplace_radix_sort);
+  ));
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+void sort(sequential::execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          unsigned int begin_bit,
+          unsigned int end_bit)
+{
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator>;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<KeyType>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  // the host path runs only the radix passes over [begin_bit, end_bit); the
+  // device path merge sorts by those bits, as stable_sort does for all keys
+  NV_IF_TARGET(NV_IS_HOST, (
+    thrust::system::detail::sequential::stable_radix_sort(exec, first, last, begin_bit, end_bit);
+  ), ( // NV_IS_DEVICE:
+    radix_sort_detail::radix_bits_less<KeyType> comp(begin_bit, end_bit);
+    thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+  ));
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 first1,
+                 RandomAccessIterator1 last1,
+                 RandomAccessIterator2 first2,
+                 unsigned int begin_bit,
+                 unsigned int end_bit)
+{
+  using KeyType = thrust::iterator_value_t<RandomAccessIterator1>;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<KeyType>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  NV_IF_TARGET(NV_IS_HOST, (
+    thrust::system::detail::sequential::stable_radix_sort_by_key(exec, first1, last1, first2, begin_bit, end_bit);
+  ), ( // NV_IS_DEVICE:
+    radix_sort_detail::radix_bits_less<KeyType> comp(begin_bit, end_bit);
+    thrust::system::detail::sequential::stable_sort_by_key(exec, first1, last1, first2, comp);
+  ));
+}
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
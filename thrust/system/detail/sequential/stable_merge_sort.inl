@@ -1,6 +1,6 @@
 /*
  *  Copyright 2008-2021 NVIDIA Corporation
- *  Modifications Copyright© 2019-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *  Modifications Copyright© 2019-2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -22,6 +22,9 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/merge.h>
+#include <thrust/reverse.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/system/detail/sequential/galloping_search.h>
 #include <thrust/system/detail/sequential/insertion_sort.h>
 #include <thrust/detail/minmax.h>
 
@@ -38,22 +41,232 @@ namespace stable_merge_sort_detail
 {
 
 
+// swaps the arguments of a comparison, so that merging reversed ranges with it
+// merges the original ranges from the back
+template<typename StrictWeakOrdering>
+struct reversed_ordering
+{
+  // mutable because StrictWeakOrdering::operator() might not be const
+  mutable StrictWeakOrdering comp;
+
+  __host__ __device__
+  reversed_ordering(StrictWeakOrdering comp)
+    : comp(comp)
+  {}
+
+  __thrust_exec_check_disable__
+  template<typename T1, typename T2>
+  __host__ __device__
+  bool operator()(const T1 &lhs, const T2 &rhs) const
+  {
+    return comp(rhs, lhs);
+  }
+};
+
+
+// the pending runs of natural_stable_merge_sort, as offsets from the start of the
+// input; a run is merged with its neighbour as soon as it is not shorter than it,
+// or than the sum of the two runs above it, so the run lengths grow at least as
+// fast as the Fibonacci numbers from the top of the stack down
+template<typename Size>
+struct run_stack
+{
+  static const int capacity = 96;
+
+  Size base[capacity];
+  Size len[capacity];
+  int size;
+
+  __host__ __device__
+  run_stack()
+    : size(0)
+  {}
+
+  __host__ __device__
+  void push(Size run_base, Size run_len)
+  {
+    base[size] = run_base;
+    len[size]  = run_len;
+    ++size;
+  }
+
+  // returns the index of the run to merge with the run after it to restore
+  // the invariants, or -1 if they already hold
+  __host__ __device__
+  int next_merge() const
+  {
+    if(size < 2) return -1;
+
+    int n = size - 2;
+
+    // the check of the third run from the top is needed for the invariants
+    // to hold for the whole stack rather than its top three runs only
+    if((n > 0 && len[n - 1] <= len[n] + len[n + 1]) ||
+       (n > 1 && len[n - 2] <= len[n - 1] + len[n]))
+    {
+      if(len[n - 1] < len[n + 1]) --n;
+    }
+    else if(len[n] > len[n + 1])
+    {
+      return -1;
+    }
+
+    return n;
+  }
+
+  // returns the index of the next run to merge once the whole input has been pushed
+  __host__ __device__
+  int next_forced_merge() const
+  {
+    if(size < 2) return -1;
+
+    int n = size - 2;
+
+    if(n > 0 && len[n - 1] < len[n + 1]) --n;
+
+    return n;
+  }
+
+  // records that run i has been merged with run i + 1
+  __host__ __device__
+  void merged(int i)
+  {
+    len[i] += len[i + 1];
+
+    if(i == size - 3)
+    {
+      base[i + 1] = base[i + 2];
+      len[i + 1]  = len[i + 2];
+    }
+
+    --size;
+  }
+};
+
+
+// returns the length of the shortest run natural_stable_merge_sort merges; shorter
+// natural runs are extended with an insertion sort. The result lies in [32, 64]
+// for n >= 64 and is chosen so that n / min_run is a power of two or slightly less,
+// which keeps the final merges balanced
+template<typename Size>
+__host__ __device__
+Size min_run_length(Size n)
+{
+  Size r = 0;
+
+  while(n >= 64)
+  {
+    r |= n & 1;
+    n >>= 1;
+  }
+
+  return n + r;
+}
+
+
+// returns the end of the run starting at first; a strictly descending run is
+// reversed, which keeps the sort stable as it holds no equivalent elements
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
 __host__ __device__
-void inplace_merge(sequential::execution_policy<DerivedPolicy> &exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+RandomAccessIterator count_run_and_make_ascending(sequential::execution_policy<DerivedPolicy> &exec,
+                                                  RandomAccessIterator first,
+                                                  RandomAccessIterator last,
+                                                  StrictWeakOrdering comp)
+{
+  RandomAccessIterator run_last = first + 1;
+
+  if(run_last == last) return last;
+
+  if(comp(*run_last, *first))
+  {
+    for(++run_last; run_last != last && comp(*run_last, *(run_last - 1)); ++run_last);
+
+    thrust::reverse(exec, first, run_last);
+  }
+  else
+  {
+    for(++run_last; run_last != last && !comp(*run_last, *(run_last - 1)); ++run_last);
+  }
+
+  return run_last;
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+__host__ __device__
+RandomAccessIterator1 count_run_and_make_ascending_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                                                          RandomAccessIterator1 keys_first,
+                                                          RandomAccessIterator1 keys_last,
+                                                          RandomAccessIterator2 values_first,
+                                                          StrictWeakOrdering comp)
+{
+  RandomAccessIterator1 run_last = keys_first + 1;
+
+  if(run_last == keys_last) return keys_last;
+
+  if(comp(*run_last, *keys_first))
+  {
+    for(++run_last; run_last != keys_last && comp(*run_last, *(run_last - 1)); ++run_last);
+
+    thrust::reverse(exec, keys_first, run_last);
+    thrust::reverse(exec, values_first, values_first + (run_last - keys_first));
+  }
+  else
+  {
+    for(++run_last; run_last != keys_last && !comp(*run_last, *(run_last - 1)); ++run_last);
+  }
+
+  return run_last;
+}
+
+
+// merges the adjacent sorted runs [first, middle) and [middle, last), copying only
+// the shorter of the two to a temporary array
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+__host__ __device__
+void merge_runs(sequential::execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator first,
+                RandomAccessIterator middle,
+                RandomAccessIterator last,
+                StrictWeakOrdering comp)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  typedef thrust::reverse_iterator<RandomAccessIterator>               reverse_iterator;
+
+  // the elements of the first run not greater than the head of the second run,
+  // and those of the second run not less than the tail of the first run, are in place
+  first = sequential::gallop_upper_bound(first, middle, *middle, comp);
+
+  if(first == middle) return;
+
+  last = sequential::gallop_lower_bound(middle, last, *(middle - 1), comp);
+
+  if(middle == last) return;
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+  if(middle - first <= last - middle)
+  {
+    thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, first, middle);
+
+    thrust::merge(exec, temp.begin(), temp.end(), middle, last, first, comp);
+  }
+  else
+  {
+    thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, middle, last);
 
-  thrust::merge(exec, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+    // merge from the back; the second run comes first so that it wins ties
+    thrust::merge(exec,
+                  thrust::make_reverse_iterator(temp.end()), thrust::make_reverse_iterator(temp.begin()),
+                  reverse_iterator(middle), reverse_iterator(first),
+                  reverse_iterator(last),
+                  reversed_ordering<StrictWeakOrdering>(comp));
+  }
 }
 
 
@@ -62,30 +275,56 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator2,
          typename StrictWeakOrdering>
 __host__ __device__
-void inplace_merge_by_key(sequential::execution_policy<DerivedPolicy> &exec,
-                          RandomAccessIterator1 first1,
-                          RandomAccessIterator1 middle1,
-                          RandomAccessIterator1 last1,
-                          RandomAccessIterator2 first2,
-                          StrictWeakOrdering comp)
+void merge_runs_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator1 keys_first,
+                       RandomAccessIterator1 keys_middle,
+                       RandomAccessIterator1 keys_last,
+                       RandomAccessIterator2 values_first,
+                       StrictWeakOrdering comp)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type1;
   typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type2;
+  typedef thrust::reverse_iterator<RandomAccessIterator1>               reverse_iterator1;
+  typedef thrust::reverse_iterator<RandomAccessIterator2>               reverse_iterator2;
+
+  RandomAccessIterator1 first = sequential::gallop_upper_bound(keys_first, keys_middle, *keys_middle, comp);
+
+  if(first == keys_middle) return;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1   - first1);
+  RandomAccessIterator1 last = sequential::gallop_lower_bound(keys_middle, keys_last, *(keys_middle - 1), comp);
+
+  if(keys_middle == last) return;
+
+  RandomAccessIterator2 values_middle = values_first + (keys_middle - keys_first);
+  values_first += first - keys_first;
+  RandomAccessIterator2 values_last   = values_middle + (last - keys_middle);
+
+  if(keys_middle - first <= last - keys_middle)
+  {
+    thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_temp(exec, first, keys_middle);
+    thrust::detail::temporary_array<value_type2, DerivedPolicy> values_temp(exec, values_first, values_middle);
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+    thrust::merge_by_key(exec,
+                         keys_temp.begin(), keys_temp.end(),
+                         keys_middle, last,
+                         values_temp.begin(), values_middle,
+                         first, values_first,
+                         comp);
+  }
+  else
+  {
+    thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_temp(exec, keys_middle, last);
+    thrust::detail::temporary_array<value_type2, DerivedPolicy> values_temp(exec, values_middle, values_last);
 
-  thrust::merge_by_key(exec,
-                       lhs1.begin(), lhs1.end(),
-                       rhs1.begin(), rhs1.end(),
-                       lhs2.begin(), rhs2.begin(),
-                       first1, first2,
-                       comp);
+    // merge from the back; the second run comes first so that it wins ties
+    thrust::merge_by_key(exec,
+                         thrust::make_reverse_iterator(keys_temp.end()), thrust::make_reverse_iterator(keys_temp.begin()),
+                         reverse_iterator1(keys_middle), reverse_iterator1(first),
+                         thrust::make_reverse_iterator(values_temp.end()),
+                         reverse_iterator2(values_middle),
+                         reverse_iterator1(last), reverse_iterator2(values_last),
+                         reversed_ordering<StrictWeakOrdering>(comp));
+  }
 }
 
 
@@ -216,7 +455,7 @@ void iterative_stable_merge_sort(sequential::execution_policy<DerivedPolicy> &ex
   difference_type partition_size = 32;
 
   // WORKAROUND: Memory access fault occurs on HIP when the size of the temp array is less than 16.
-  // This workaround is based on the check that's used in the recursive version.
+  // This workaround is based on the 32 element insertion sort of the host version.
   if(n <= partition_size)
   {
     insertion_sort_each(first, last, partition_size, comp);
@@ -273,7 +512,7 @@ void iterative_stable_merge_sort_by_key(sequential::execution_policy<DerivedPoli
   difference_type partition_size = 32;
 
   // WORKAROUND: Memory access fault occurs on HIP when the size of the temp array is less than 16.
-  // This workaround is based on the check that's used in the recursive version.
+  // This workaround is based on the 32 element insertion sort of the host version.
   if(n <= partition_size)
   {
     // insertion sort each 32 element partition
@@ -314,28 +553,68 @@ void iterative_stable_merge_sort_by_key(sequential::execution_policy<DerivedPoli
 } // end iterative_stable_merge_sort()
 
 
+// a natural merge sort: the input is split into its existing ascending and
+// strictly descending runs, descending runs are reversed, runs shorter than
+// min_run_length(n) are extended with an insertion sort, and the runs are merged
+// as they are found, keeping the lengths of the pending runs balanced. Sorted or
+// reverse sorted input is a single run and takes n - 1 comparisons
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
 __host__ __device__
-void recursive_stable_merge_sort(sequential::execution_policy<DerivedPolicy> &exec,
-                                 RandomAccessIterator first,
-                                 RandomAccessIterator last,
-                                 StrictWeakOrdering comp)
+void natural_stable_merge_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                               RandomAccessIterator first,
+                               RandomAccessIterator last,
+                               StrictWeakOrdering comp)
 {
-  if(last - first <= 32)
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type difference_type;
+
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  const difference_type n = last - first;
+
+  if(n < 2) return;
+
+  const difference_type min_run = min_run_length(n);
+
+  run_stack<difference_type> runs;
+
+  for(RandomAccessIterator run_first = first; run_first != last;)
   {
-    thrust::system::detail::sequential::insertion_sort(first, last, comp);
-  } // end if
-  else
+    RandomAccessIterator run_last = count_run_and_make_ascending(exec, run_first, last, wrapped_comp);
+
+    if(run_last - run_first < min_run)
+    {
+      run_last = (thrust::min)(last, run_first + min_run);
+
+      thrust::system::detail::sequential::insertion_sort(run_first, run_last, comp);
+    }
+
+    runs.push(run_first - first, run_last - run_first);
+
+    for(int i = runs.next_merge(); i >= 0; i = runs.next_merge())
+    {
+      RandomAccessIterator run = first + runs.base[i];
+
+      merge_runs(exec, run, run + runs.len[i], run + runs.len[i] + runs.len[i + 1], wrapped_comp);
+      runs.merged(i);
+    }
+
+    run_first = run_last;
+  }
+
+  for(int i = runs.next_forced_merge(); i >= 0; i = runs.next_forced_merge())
   {
-    RandomAccessIterator middle = first + (last - first) / 2;
+    RandomAccessIterator run = first + runs.base[i];
 
-    stable_merge_sort_detail::recursive_stable_merge_sort(exec, first, middle, comp);
-    stable_merge_sort_detail::recursive_stable_merge_sort(exec, middle,  last, comp);
-    stable_merge_sort_detail::inplace_merge(exec, first, middle, last, comp);
-  } // end else
-} // end recursive_stable_merge_sort()
+    merge_runs(exec, run, run + runs.len[i], run + runs.len[i] + runs.len[i + 1], wrapped_comp);
+    runs.merged(i);
+  }
+} // end natural_stable_merge_sort()
 
 
 template<typename DerivedPolicy,
@@ -343,26 +622,61 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator2,
          typename StrictWeakOrdering>
 __host__ __device__
-void recursive_stable_merge_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
-                                        RandomAccessIterator1 first1,
-                                        RandomAccessIterator1 last1,
-                                        RandomAccessIterator2 first2,
-                                        StrictWeakOrdering comp)
+void natural_stable_merge_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                                      RandomAccessIterator1 keys_first,
+                                      RandomAccessIterator1 keys_last,
+                                      RandomAccessIterator2 values_first,
+                                      StrictWeakOrdering comp)
 {
-  if(last1 - first1 <= 32)
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type difference_type;
+
+  // wrap comp
+  thrust::detail::wrapped_function<
+    StrictWeakOrdering,
+    bool
+  > wrapped_comp(comp);
+
+  const difference_type n = keys_last - keys_first;
+
+  if(n < 2) return;
+
+  const difference_type min_run = min_run_length(n);
+
+  run_stack<difference_type> runs;
+
+  for(RandomAccessIterator1 run_first = keys_first; run_first != keys_last;)
   {
-    thrust::system::detail::sequential::insertion_sort_by_key(first1, last1, first2, comp);
-  } // end if
-  else
+    RandomAccessIterator2 run_values = values_first + (run_first - keys_first);
+    RandomAccessIterator1 run_last   = count_run_and_make_ascending_by_key(exec, run_first, keys_last, run_values, wrapped_comp);
+
+    if(run_last - run_first < min_run)
+    {
+      run_last = (thrust::min)(keys_last, run_first + min_run);
+
+      thrust::system::detail::sequential::insertion_sort_by_key(run_first, run_last, run_values, comp);
+    }
+
+    runs.push(run_first - keys_first, run_last - run_first);
+
+    for(int i = runs.next_merge(); i >= 0; i = runs.next_merge())
+    {
+      RandomAccessIterator1 run = keys_first + runs.base[i];
+
+      merge_runs_by_key(exec, run, run + runs.len[i], run + runs.len[i] + runs.len[i + 1], values_first + runs.base[i], wrapped_comp);
+      runs.merged(i);
+    }
+
+    run_first = run_last;
+  }
+
+  for(int i = runs.next_forced_merge(); i >= 0; i = runs.next_forced_merge())
   {
-    RandomAccessIterator1 middle1 = first1 + (last1 - first1) / 2;
-    RandomAccessIterator2 middle2 = first2 + (last1 - first1) / 2;
+    RandomAccessIterator1 run = keys_first + runs.base[i];
 
-    stable_merge_sort_detail::recursive_stable_merge_sort_by_key(exec, first1, middle1, first2,  comp);
-    stable_merge_sort_detail::recursive_stable_merge_sort_by_key(exec, middle1,  last1, middle2, comp);
-    stable_merge_sort_detail::inplace_merge_by_key(exec, first1, middle1, last1, first2, comp);
-  } // end else
-} // end recursive_stable_merge_sort_by_key()
+    merge_runs_by_key(exec, run, run + runs.len[i], run + runs.len[i] + runs.len[i + 1], values_first + runs.base[i], wrapped_comp);
+    runs.merged(i);
+  }
+} // end natural_stable_merge_sort_by_key()
 
 
 } // end namespace stable_merge_sort_detail
@@ -381,7 +695,7 @@ void stable_merge_sort(sequential::execution_policy<DerivedPolicy> &exec,
     // avoid recursion in CUDA or HIP threads
     stable_merge_sort_detail::iterative_stable_merge_sort(exec, first, last, comp);
   ), (
-    stable_merge_sort_detail::recursive_stable_merge_sort(exec, first, last, comp);
+    stable_merge_sort_detail::natural_stable_merge_sort(exec, first, last, comp);
   ));
 }
 
@@ -401,7 +715,7 @@ void stable_merge_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
     // avoid recursion in CUDA or HIP threads
     stable_merge_sort_detail::iterative_stable_merge_sort_by_key(exec, first1, last1, first2, comp);
   ), (
-    stable_merge_sort_detail::recursive_stable_merge_sort_by_key(exec, first1, last1, first2, comp);
+    stable_merge_sort_detail::natural_stable_merge_sort_by_key(exec, first1, last1, first2, comp);
   ));
 }
 
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -46,6 +47,29 @@ void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
                               RandomAccessIterator2 values_begin);
 
 
+// sorts arithmetic keys by the bits [begin_bit, end_bit) of their radix encoding
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+void stable_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator begin,
+                       RandomAccessIterator end,
+                       unsigned int begin_bit,
+                       unsigned int end_bit);
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 keys_begin,
+                              RandomAccessIterator1 keys_end,
+                              RandomAccessIterator2 values_begin,
+                              unsigned int begin_bit,
+                              unsigned int end_bit);
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
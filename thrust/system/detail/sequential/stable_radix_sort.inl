@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2021 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -26,8 +27,12 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/cstdint.h>
 #include <thrust/scatter.h>
+#include <thrust/tuple.h>
+#include <thrust/type_traits/radix_key_decomposer.h>
+#include <thrust/type_traits/remove_cvref.h>
 
 #include <limits>
+#include <utility>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -140,23 +145,78 @@ struct RadixEncoder<double> : public thrust::unary_function<double, thrust::deta
 };
 
 
+// orders arithmetic keys by the bits [begin_bit, end_bit) of their encoding,
+// which is the order a radix sort restricted to those bits sorts them in
+template<typename KeyType>
+struct radix_bits_less
+{
+  typedef RadixEncoder<KeyType> Encoder;
+
+  thrust::detail::uint64_t mask;
+
+  __host__ __device__
+  radix_bits_less(unsigned int begin_bit, unsigned int end_bit)
+    : mask(0)
+  {
+    if(begin_bit < end_bit && begin_bit < 64)
+    {
+      const thrust::detail::uint64_t one = 1;
+
+      mask = end_bit >= 64 ? ~thrust::detail::uint64_t(0) : (one << end_bit) - 1;
+      mask &= ~((one << begin_bit) - 1);
+    }
+  }
+
+  __host__ __device__
+  bool operator()(const KeyType &lhs, const KeyType &rhs) const
+  {
+    Encoder encode;
+
+    return (static_cast<thrust::detail::uint64_t>(encode(lhs)) & mask) <
+           (static_cast<thrust::detail::uint64_t>(encode(rhs)) & mask);
+  }
+};
+
+
+// encodes field I of the decomposition of a key by radix_key_decomposer
+template<typename KeyType, unsigned int I>
+struct RadixFieldEncoder
+{
+  typedef thrust::radix_key_decomposer<KeyType> Decomposer;
+  typedef typename thrust::remove_cvref<
+    decltype(Decomposer()(std::declval<const KeyType&>()))
+  >::type FieldTuple;
+  typedef typename thrust::remove_cvref<
+    typename thrust::tuple_element<I, FieldTuple>::type
+  >::type FieldType;
+  typedef RadixEncoder<FieldType> FieldEncoder;
+  typedef typename FieldEncoder::result_type result_type;
+
+  __host__ __device__
+  result_type operator()(const KeyType &key) const
+  {
+    return FieldEncoder()(thrust::get<I>(Decomposer()(key)));
+  }
+};
+
+
 // this functor returns a key's to its histogram bucket count and post-increments the bucket
-template<unsigned int RadixBits, typename KeyType>
+template<unsigned int RadixBits, typename KeyType, typename Encoder = RadixEncoder<KeyType> >
   struct bucket_functor
 {
-  typedef RadixEncoder<KeyType> Encoder;
   typedef typename Encoder::result_type EncodedType;
   typedef size_t result_type;
-  static const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
   Encoder encode;
   EncodedType bit_shift;
+  EncodedType bit_mask;
   size_t *histogram;
 
   __host__ __device__
-  bucket_functor(EncodedType bit_shift, size_t *histogram)
+  bucket_functor(EncodedType bit_shift, EncodedType bit_mask, size_t *histogram)
     : encode(),
       bit_shift(bit_shift),
+      bit_mask(bit_mask),
       histogram(histogram)
   {}
 
@@ -166,12 +226,13 @@ template<unsigned int RadixBits, typename KeyType>
     const EncodedType x = encode(key);
 
     // note that we mutate the histogram here
-    return histogram[(x >> bit_shift) & BitMask]++;
+    return histogram[(x >> bit_shift) & bit_mask]++;
   }
 };
 
 
 template<unsigned int RadixBits,
+         typename Encoder,
          typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
@@ -182,6 +243,7 @@ void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
                      const size_t n,
                      RandomAccessIterator2 result,
                      Integer bit_shift,
+                     Integer bit_mask,
                      size_t *histogram)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
@@ -189,12 +251,13 @@ void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
   // note that we are going to mutate the histogram during this sequential scatter
   thrust::scatter(exec,
                   first, first + n,
-                  thrust::make_transform_iterator(first, bucket_functor<RadixBits,KeyType>(bit_shift, histogram)),
+                  thrust::make_transform_iterator(first, bucket_functor<RadixBits,KeyType,Encoder>(bit_shift, bit_mask, histogram)),
                   result);
 }
 
 
 template<unsigned int RadixBits,
+         typename Encoder,
          typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
@@ -209,6 +272,7 @@ void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
                      RandomAccessIterator3 keys_result,
                      RandomAccessIterator4 values_result,
                      Integer bit_shift,
+                     Integer bit_mask,
                      size_t *histogram)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
@@ -217,56 +281,88 @@ void radix_shuffle_n(sequential::execution_policy<DerivedPolicy> &exec,
   thrust::scatter(exec,
                   thrust::make_zip_iterator(thrust::make_tuple(keys_first, values_first)),
                   thrust::make_zip_iterator(thrust::make_tuple(keys_first + n, values_first + n)),
-                  thrust::make_transform_iterator(keys_first, bucket_functor<RadixBits,KeyType>(bit_shift, histogram)),
+                  thrust::make_transform_iterator(keys_first, bucket_functor<RadixBits,KeyType,Encoder>(bit_shift, bit_mask, histogram)),
                   thrust::make_zip_iterator(thrust::make_tuple(keys_result, values_result)));
 }
 
 
+// returns the number of bits of the keys encoded by Encoder
+template<typename Encoder>
+struct radix_encoded_bits
+{
+  static const unsigned int value = 8 * sizeof(typename Encoder::result_type);
+};
+
+
+// sorts the keys by the bits [begin_bit, end_bit) of Encoder()(key),
+// ping-ponging between (keys1,vals1) and (keys2,vals2); flip is true if
+// the most recent data is stored in (keys2,vals2), both on entry and on return
 template<unsigned int RadixBits,
          bool HasValues,
+         typename Encoder,
          typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename RandomAccessIterator3,
          typename RandomAccessIterator4>
 __host__ __device__
-void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
-                RandomAccessIterator1 keys1,
-                RandomAccessIterator2 keys2,
-                RandomAccessIterator3 vals1,
-                RandomAccessIterator4 vals2,
-                const size_t N)
+void radix_sort_passes(sequential::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator1 keys1,
+                       RandomAccessIterator2 keys2,
+                       RandomAccessIterator3 vals1,
+                       RandomAccessIterator4 vals2,
+                       const size_t N,
+                       bool &flip,
+                       unsigned int begin_bit = 0,
+                       unsigned int end_bit = radix_encoded_bits<Encoder>::value)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-
-  typedef RadixEncoder<KeyType> Encoder;
   typedef typename Encoder::result_type EncodedType;
 
-  const unsigned int NumHistograms = (8 * sizeof(EncodedType) + (RadixBits - 1)) / RadixBits;
+  const unsigned int MaxHistograms = (8 * sizeof(EncodedType) + (RadixBits - 1)) / RadixBits;
   const unsigned int HistogramSize =  1 << RadixBits;
 
   const EncodedType BitMask = static_cast<EncodedType>((1 << RadixBits) - 1);
 
+  if(end_bit > radix_encoded_bits<Encoder>::value)
+  {
+    end_bit = radix_encoded_bits<Encoder>::value;
+  }
+
+  if(begin_bit >= end_bit)
+  {
+    return;
+  }
+
+  // one pass per digit of the bits [begin_bit, end_bit)
+  const unsigned int NumHistograms = (end_bit - begin_bit + (RadixBits - 1)) / RadixBits;
+
+  // the last digit may be narrower than RadixBits
+  EncodedType bit_masks[MaxHistograms] = {};
+
+  for(unsigned int j = 0; j < NumHistograms; j++)
+  {
+    const unsigned int bits = end_bit - begin_bit - RadixBits * j;
+
+    bit_masks[j] = bits < RadixBits ? static_cast<EncodedType>((1 << bits) - 1) : BitMask;
+  }
+
   Encoder encode;
 
   // storage for histograms
-  size_t histograms[NumHistograms][HistogramSize] = {{0}};
+  size_t histograms[MaxHistograms][HistogramSize] = {{0}};
 
   // see which passes can be eliminated
-  bool skip_shuffle[NumHistograms] = {false};
-
-  // false if most recent data is stored in (keys1,vals1)
-  bool flip = false;
+  bool skip_shuffle[MaxHistograms] = {false};
 
   // compute histograms
   for(size_t i = 0; i < N; i++)
   {
-    const EncodedType x = encode(keys1[i]);
+    const EncodedType x = flip ? encode(keys2[i]) : encode(keys1[i]);
 
     for(unsigned int j = 0; j < NumHistograms; j++)
     {
-      const auto BitShift = static_cast<EncodedType>(RadixBits * j);
-      histograms[j][(x >> BitShift) & BitMask]++;
+      const unsigned int BitShift = begin_bit + RadixBits * j;
+      histograms[j][(x >> BitShift) & bit_masks[j]]++;
     }
   }
 
@@ -291,7 +387,7 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
   // shuffle keys and (optionally) values
   for(unsigned int i = 0; i < NumHistograms; i++)
   {
-    const EncodedType BitShift = static_cast<EncodedType>(RadixBits * i);
+    const EncodedType BitShift = static_cast<EncodedType>(begin_bit + RadixBits * i);
 
     if(!skip_shuffle[i])
     {
@@ -299,28 +395,54 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
       {
         if(HasValues)
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, vals2, N, keys1, vals1, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits,Encoder>(exec, keys2, vals2, N, keys1, vals1, BitShift, bit_masks[i], histograms[i]);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys2, N, keys1, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits,Encoder>(exec, keys2, N, keys1, BitShift, bit_masks[i], histograms[i]);
         }
       }
       else
       {
         if(HasValues)
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, vals1, N, keys2, vals2, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits,Encoder>(exec, keys1, vals1, N, keys2, vals2, BitShift, bit_masks[i], histograms[i]);
         }
         else
         {
-          radix_shuffle_n<RadixBits>(exec, keys1, N, keys2, BitShift, histograms[i]);
+          radix_shuffle_n<RadixBits,Encoder>(exec, keys1, N, keys2, BitShift, bit_masks[i], histograms[i]);
         }
       }
 
       flip = (flip) ? false : true;
     }
   }
+}
+
+
+template<unsigned int RadixBits,
+         bool HasValues,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                const size_t N,
+                unsigned int begin_bit,
+                unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  radix_sort_passes<RadixBits,HasValues,RadixEncoder<KeyType> >(exec, keys1, keys2, vals1, vals2, N, flip, begin_bit, end_bit);
 
   // ensure final values are in (keys1,vals1)
   if(flip)
@@ -351,9 +473,10 @@ struct radix_sort_dispatcher<1>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
-    radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+    radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
   }
 
   template<typename DerivedPolicy,
@@ -365,9 +488,10 @@ struct radix_sort_dispatcher<1>
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
-    radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+    radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
   }
 };
 
@@ -381,7 +505,8 @@ struct radix_sort_dispatcher<2>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
 #ifdef __QNX__
     // XXX war for nvbug 200193674
@@ -391,11 +516,11 @@ struct radix_sort_dispatcher<2>
 #endif
     if (condition)
     {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<16,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<16,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
     }
   }
 
@@ -409,7 +534,8 @@ struct radix_sort_dispatcher<2>
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
 #ifdef __QNX__
     // XXX war for nvbug 200193674
@@ -419,11 +545,11 @@ struct radix_sort_dispatcher<2>
 #endif
     if (condition)
     {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<16,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<16,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
     }
   }
 };
@@ -438,15 +564,16 @@ struct radix_sort_dispatcher<4>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
     if(N < (1 << 22))
     {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
     }
   }
 
@@ -459,15 +586,16 @@ struct radix_sort_dispatcher<4>
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
     if(N < (1 << 22))
     {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
     }
   }
 };
@@ -482,15 +610,16 @@ struct radix_sort_dispatcher<8>
   __host__ __device__
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
     if(N < (1 << 21))
     {
-      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<8,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+      radix_sort_detail::radix_sort<4,false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N, begin_bit, end_bit);
     }
   }
 
@@ -503,20 +632,166 @@ struct radix_sort_dispatcher<8>
   void operator()(sequential::execution_policy<DerivedPolicy> &exec,
                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
-                  const size_t N)
+                  const size_t N,
+                  unsigned int begin_bit, unsigned int end_bit)
   {
     if(N < (1 << 21))
     {
-      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<8,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
     }
     else
     {
-      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N);
+      radix_sort_detail::radix_sort<3,true>(exec, keys1, keys2, vals1, vals2, N, begin_bit, end_bit);
     }
   }
 };
 
 
+// sorts keys decomposed by radix_key_decomposer by their fields [0, NumFields),
+// least significant field first, so that the sort is lexicographical
+template<typename KeyType, unsigned int NumFields>
+struct composite_radix_sorter
+{
+  template<bool HasValues,
+           typename DerivedPolicy,
+           typename RandomAccessIterator1,
+           typename RandomAccessIterator2,
+           typename RandomAccessIterator3,
+           typename RandomAccessIterator4>
+  __host__ __device__
+  static void sort(sequential::execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys1, RandomAccessIterator2 keys2,
+                   RandomAccessIterator3 vals1, RandomAccessIterator4 vals2,
+                   const size_t N,
+                   bool &flip)
+  {
+    radix_sort_passes<8,HasValues,RadixFieldEncoder<KeyType,NumFields - 1> >(exec, keys1, keys2, vals1, vals2, N, flip);
+
+    composite_radix_sorter<KeyType,NumFields - 1>::template sort<HasValues>(exec, keys1, keys2, vals1, vals2, N, flip);
+  }
+};
+
+
+template<typename KeyType>
+struct composite_radix_sorter<KeyType,0>
+{
+  template<bool HasValues,
+           typename DerivedPolicy,
+           typename RandomAccessIterator1,
+           typename RandomAccessIterator2,
+           typename RandomAccessIterator3,
+           typename RandomAccessIterator4>
+  __host__ __device__
+  static void sort(sequential::execution_policy<DerivedPolicy> &,
+                   RandomAccessIterator1, RandomAccessIterator2,
+                   RandomAccessIterator3, RandomAccessIterator4,
+                   const size_t,
+                   bool &)
+  {}
+};
+
+
+template<bool HasValues,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+void composite_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 keys1,
+                          RandomAccessIterator2 keys2,
+                          RandomAccessIterator3 vals1,
+                          RandomAccessIterator4 vals2,
+                          const size_t N)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename RadixFieldEncoder<KeyType,0>::FieldTuple            FieldTuple;
+
+  // false if most recent data is stored in (keys1,vals1)
+  bool flip = false;
+
+  composite_radix_sorter<KeyType,thrust::tuple_size<FieldTuple>::value>::template sort<HasValues>(exec, keys1, keys2, vals1, vals2, N, flip);
+
+  // ensure final values are in (keys1,vals1)
+  if(flip)
+  {
+    thrust::copy(exec, keys2, keys2 + N, keys1);
+
+    if(HasValues)
+    {
+      thrust::copy(exec, vals2, vals2 + N, vals1);
+    }
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                const size_t N,
+                thrust::detail::true_type) // is_arithmetic
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, N, 0, radix_encoded_bits<RadixEncoder<KeyType> >::value);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                const size_t N,
+                thrust::detail::false_type) // is_arithmetic
+{
+  radix_sort_detail::composite_radix_sort<false>(exec, keys1, keys2, static_cast<int *>(0), static_cast<int *>(0), N);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                const size_t N,
+                thrust::detail::true_type) // is_arithmetic
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, vals1, vals2, N, 0, radix_encoded_bits<RadixEncoder<KeyType> >::value);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4>
+__host__ __device__
+void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator1 keys1,
+                RandomAccessIterator2 keys2,
+                RandomAccessIterator3 vals1,
+                RandomAccessIterator4 vals2,
+                const size_t N,
+                thrust::detail::false_type) // is_arithmetic
+{
+  radix_sort_detail::composite_radix_sort<true>(exec, keys1, keys2, vals1, vals2, N);
+}
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2>
@@ -527,7 +802,8 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                 const size_t N)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, N);
+  thrust::detail::is_arithmetic<KeyType> is_arithmetic;
+  radix_sort_detail::radix_sort(exec, keys1, keys2, N, is_arithmetic);
 }
 
 
@@ -545,7 +821,8 @@ void radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
                 const size_t N)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
-  radix_sort_dispatcher<sizeof(KeyType)>()(exec, keys1, keys2, vals1, vals2, N);
+  thrust::detail::is_arithmetic<KeyType> is_arithmetic;
+  radix_sort_detail::radix_sort(exec, keys1, keys2, vals1, vals2, N, is_arithmetic);
 }
 
 
@@ -590,6 +867,48 @@ void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
 }
 
 
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+__host__ __device__
+void stable_radix_sort(sequential::execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator first,
+                       RandomAccessIterator last,
+                       unsigned int begin_bit,
+                       unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  size_t N = last - first;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> temp(exec, N);
+
+  radix_sort_detail::radix_sort_dispatcher<sizeof(KeyType)>()(exec, first, temp.begin(), N, begin_bit, end_bit);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+__host__ __device__
+void stable_radix_sort_by_key(sequential::execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 first1,
+                              RandomAccessIterator1 last1,
+                              RandomAccessIterator2 first2,
+                              unsigned int begin_bit,
+                              unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+
+  size_t N = last1 - first1;
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy>   temp1(exec, N);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> temp2(exec, N);
+
+  radix_sort_detail::radix_sort_dispatcher<sizeof(KeyType)>()(exec, first1, temp1.begin(), first2, temp2.begin(), N, begin_bit, end_bit);
+}
+
+
 } // end namespace sequential
 } // end namespace detail
 } // end namespace system
@@ -0,0 +1,94 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file compact_tiles.h
+ *  \brief OpenMP implementation of the second phase of the in-place compactions.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/internal/compact_tiles.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+
+
+// moves [first + kept_begins[i], first + kept_ends[i]) to follow the kept elements
+// of the tiles before it, for every tile in parallel, and returns the end of the
+// compacted range
+template<typename DerivedPolicy, typename RandomAccessIterator, typename Size>
+RandomAccessIterator shift_compacted_tiles(execution_policy<DerivedPolicy> &exec,
+                                           RandomAccessIterator first,
+                                           const Size *kept_begins,
+                                           const Size *kept_ends,
+                                           Size num_tiles)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type ValueType;
+
+  thrust::detail::temporary_array<Size,DerivedPolicy> targets_storage(exec, num_tiles + 1);
+  Size *targets = thrust::raw_pointer_cast(targets_storage.data());
+
+  const Size max_distance = thrust::system::detail::internal::plan_compacted_tiles_shift(kept_begins, kept_ends, num_tiles, targets);
+  const Size buffer_size  = thrust::system::detail::internal::compacted_tiles_shift_buffer_size<ValueType>(max_distance);
+
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> buffer(exec, num_tiles * buffer_size);
+
+  typedef thrust::system::detail::internal::shift_compacted_tiles_pass<
+    RandomAccessIterator,
+    Size,
+    typename thrust::detail::temporary_array<ValueType,DerivedPolicy>::iterator
+  > Pass;
+
+  Pass pass(first, kept_begins, targets, num_tiles, buffer.begin(), buffer_size);
+
+  while(pass.next_window())
+  {
+    if(pass.buffers())
+    {
+      THRUST_PRAGMA_OMP(parallel for)
+      for(Size k = 0; k < num_tiles; ++k)
+      {
+        pass.buffer_piece(k);
+      }
+    }
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(Size k = 0; k < num_tiles; ++k)
+    {
+      pass.move_piece(k);
+    }
+  }
+
+  return first + targets[num_tiles];
+}
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,9 +19,14 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/copy.h>
-#include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
 
 
 THRUST_NAMESPACE_BEGIN
@@ -30,6 +36,71 @@ namespace omp
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+// copies every tile of the default decomposition on its own thread, so the
+// output is first touched by the threads which later process the same tiles;
+// this places the pages of a newly allocated omp::vector on the NUMA node
+// of the threads that use them
+template<typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(InputIterator first,
+                        Size n,
+                        OutputIterator result)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType signed_n = n;
+
+  if(signed_n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::copy_n(thrust::seq, first, n, result);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(signed_n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::copy_n(thrust::seq, first, n, result);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::copy_n(thrust::seq, first + decomp[i].begin(), decomp[i].size(), result + decomp[i].begin());
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + signed_n;
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -50,13 +121,13 @@ template<typename DerivedPolicy,
 template<typename DerivedPolicy,
          typename InputIterator,
          typename OutputIterator>
-  OutputIterator copy(execution_policy<DerivedPolicy> &exec,
+  OutputIterator copy(execution_policy<DerivedPolicy> &,
                       InputIterator first,
                       InputIterator last,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return copy_detail::copy_n(first, thrust::distance(first, last), result);
 } // end copy()
 
 
@@ -78,13 +149,13 @@ template<typename DerivedPolicy,
          typename InputIterator,
          typename Size,
          typename OutputIterator>
-  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &,
                         InputIterator first,
                         Size n,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return copy_detail::copy_n(first, n, result);
 } // end copy_n()
 
 
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,7 +19,18 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/copy_if.h>
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -41,8 +53,69 @@ template<typename DerivedPolicy,
                          OutputIterator result,
                          Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::copy_if(thrust::seq, first, last, stencil, result, pred);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap pred
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  IndexType num_tiles = decomp.size();
+
+  // the only scratch space is one offset per tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> offsets_storage(exec, num_tiles + 1);
+  IndexType *offsets = thrust::raw_pointer_cast(offsets_storage.data());
+
+  // count the selected elements of each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    offsets[i] = thrust::count_if(thrust::seq,
+                                  stencil + decomp[i].begin(),
+                                  stencil + decomp[i].end(),
+                                  wrapped_pred);
+  }
+
+  // scan the counts to find where each tile's output begins
+  offsets[num_tiles] = 0;
+  thrust::exclusive_scan(thrust::seq, offsets, offsets + num_tiles + 1, offsets);
+
+  // compact every tile into its place
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::copy_if(thrust::seq,
+                    first + decomp[i].begin(),
+                    first + decomp[i].end(),
+                    stencil + decomp[i].begin(),
+                    result + offsets[i],
+                    wrapped_pred);
+  }
+
+  return result + offsets[num_tiles];
+#else
+  return result;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 } // end copy_if()
 
 
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/find.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/distance.h>
+#include <thrust/find.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace find_if_detail
+{
+
+// the number of elements a thread examines between polls of the position found so far
+const int block_size = 1 << 14;
+
+} // end namespace find_if_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy> &,
+                      InputIterator first,
+                      InputIterator last,
+                      Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(n <= find_if_detail::block_size)
+  {
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap pred
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  const IndexType num_blocks = (n + find_if_detail::block_size - 1) / find_if_detail::block_size;
+
+  // the position of the first match found so far; a block which begins
+  // past it cannot hold the first match and is skipped
+  IndexType result = n;
+
+  // dynamic scheduling hands out the blocks in order, so once a match is
+  // found, every block preceding it is already being searched
+  THRUST_PRAGMA_OMP(parallel for schedule(dynamic))
+  for(IndexType i = 0; i < num_blocks; ++i)
+  {
+    const IndexType block_begin = i * find_if_detail::block_size;
+
+    IndexType found_so_far;
+    THRUST_PRAGMA_OMP(atomic read)
+    found_so_far = result;
+
+    if(block_begin < found_so_far)
+    {
+      const IndexType block_end = (thrust::min)(n, block_begin + find_if_detail::block_size);
+
+      const IndexType found = thrust::find_if(thrust::seq,
+                                              first + block_begin,
+                                              first + block_end,
+                                              wrapped_pred) - first;
+
+      if(found < block_end)
+      {
+        THRUST_PRAGMA_OMP(critical)
+        {
+          if(found < result)
+          {
+            THRUST_PRAGMA_OMP(atomic write)
+            result = found;
+          }
+        }
+      }
+    }
+  }
+
+  return first + result;
+#else
+  return last;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
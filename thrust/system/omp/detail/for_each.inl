@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -22,6 +23,7 @@
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/omp/detail/par.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -31,12 +33,81 @@ namespace omp
 {
 namespace detail
 {
+namespace for_each_detail
+{
+
+
+// below this many elements, the cost of forking threads exceeds that of the loop
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 4096;
+
+
+// runs the loop with the schedule requested by the policy, spelled out in the pragma
+// so that the run-sched-var ICV, which other threads may read, is left untouched
+template<typename RandomAccessIterator,
+         typename DifferenceType,
+         typename UnaryFunction>
+void scheduled_for_each_n(RandomAccessIterator first,
+                          DifferenceType n,
+                          UnaryFunction f,
+                          schedule_t schedule)
+{
+  // OpenMP's default chunk size is 1 for the dynamic and guided schedules
+  const int chunk_size = schedule.chunk_size > 0 ? schedule.chunk_size : 1;
+
+  switch(schedule.kind)
+  {
+    case schedule_dynamic:
+      THRUST_PRAGMA_OMP(parallel for schedule(dynamic, chunk_size))
+      for(DifferenceType i = 0; i < n; ++i)
+      {
+        RandomAccessIterator temp = first + i;
+        f(*temp);
+      }
+      break;
+
+    case schedule_guided:
+      THRUST_PRAGMA_OMP(parallel for schedule(guided, chunk_size))
+      for(DifferenceType i = 0; i < n; ++i)
+      {
+        RandomAccessIterator temp = first + i;
+        f(*temp);
+      }
+      break;
+
+    default:
+      // the static schedule without a chunk size splits the loop into one chunk per thread
+      if(schedule.chunk_size > 0)
+      {
+        THRUST_PRAGMA_OMP(parallel for schedule(static, chunk_size))
+        for(DifferenceType i = 0; i < n; ++i)
+        {
+          RandomAccessIterator temp = first + i;
+          f(*temp);
+        }
+      }
+      else
+      {
+        THRUST_PRAGMA_OMP(parallel for schedule(static))
+        for(DifferenceType i = 0; i < n; ++i)
+        {
+          RandomAccessIterator temp = first + i;
+          f(*temp);
+        }
+      }
+      break;
+  }
+}
+
+
+} // end for_each_detail
+
 
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename Size,
          typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
+RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &exec,
                                 RandomAccessIterator first,
                                 Size n,
                                 UnaryFunction f)
@@ -62,15 +133,38 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy> &,
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type DifferenceType;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for(DifferenceType i = 0;
-      i < signed_n;
-      ++i)
+  schedule_t schedule = get_schedule(thrust::detail::derived_cast(exec));
+
+  if(!schedule.is_specified)
   {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
+    if(signed_n < for_each_detail::parallelism_threshold)
+    {
+      // don't bother parallelizing for small n
+      for(DifferenceType i = 0;
+          i < signed_n;
+          ++i)
+      {
+        RandomAccessIterator temp = first + i;
+        wrapped_f(*temp);
+      }
+
+      return first + n;
+    }
+
+    THRUST_PRAGMA_OMP(parallel for)
+    for(DifferenceType i = 0;
+        i < signed_n;
+        ++i)
+    {
+      RandomAccessIterator temp = first + i;
+      wrapped_f(*temp);
+    }
+
+    return first + n;
   }
 
+  for_each_detail::scheduled_for_each_n(first, signed_n, wrapped_f, schedule);
+
   return first + n;
 } // end for_each_n()
 
@@ -0,0 +1,223 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/distance.h>
+#include <thrust/merge.h>
+#include <thrust/pair.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace merge_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+} // end merge_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+OutputIterator merge(execution_policy<DerivedPolicy> &,
+                     InputIterator1 first1,
+                     InputIterator1 last1,
+                     InputIterator2 first2,
+                     InputIterator2 last2,
+                     OutputIterator result,
+                     StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n1 = thrust::distance(first1, last1);
+  const IndexType n2 = thrust::distance(first2, last2);
+
+  if(n1 + n2 < merge_detail::parallelism_threshold || n1 == 0 || n2 == 0)
+  {
+    // don't bother parallelizing for small n, or when one input is empty
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+  // partition the output into one diagonal per thread
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n1 + n2);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+  IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    // find where this thread's diagonals cross the merge path
+    IndexType diag_first = decomp[i].begin();
+    IndexType diag_last  = decomp[i].end();
+
+    IndexType mid1_first = thrust::system::detail::internal::merge_path(first1, first2, n1, n2, diag_first, wrapped_comp);
+    IndexType mid1_last  = thrust::system::detail::internal::merge_path(first1, first2, n1, n2, diag_last,  wrapped_comp);
+
+    thrust::merge(thrust::seq,
+                  first1 + mid1_first, first1 + mid1_last,
+                  first2 + (diag_first - mid1_first), first2 + (diag_last - mid1_last),
+                  result + diag_first,
+                  comp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + (n1 + n2);
+} // end merge()
+
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+thrust::pair<OutputIterator1,OutputIterator2>
+  merge_by_key(execution_policy<DerivedPolicy> &,
+               InputIterator1 keys_first1,
+               InputIterator1 keys_last1,
+               InputIterator2 keys_first2,
+               InputIterator2 keys_last2,
+               InputIterator3 values_first3,
+               InputIterator4 values_first4,
+               OutputIterator1 keys_result,
+               OutputIterator2 values_result,
+               StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type IndexType;
+
+  const IndexType n1 = thrust::distance(keys_first1, keys_last1);
+  const IndexType n2 = thrust::distance(keys_first2, keys_last2);
+
+  if(n1 + n2 < merge_detail::parallelism_threshold || n1 == 0 || n2 == 0)
+  {
+    // don't bother parallelizing for small n, or when one input is empty
+    return thrust::merge_by_key(thrust::seq,
+                                keys_first1, keys_last1,
+                                keys_first2, keys_last2,
+                                values_first3, values_first4,
+                                keys_result, values_result,
+                                comp);
+  }
+
+  // partition the output into one diagonal per thread
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n1 + n2);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::merge_by_key(thrust::seq,
+                                keys_first1, keys_last1,
+                                keys_first2, keys_last2,
+                                values_first3, values_first4,
+                                keys_result, values_result,
+                                comp);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
+  IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    // find where this thread's diagonals cross the merge path
+    IndexType diag_first = decomp[i].begin();
+    IndexType diag_last  = decomp[i].end();
+
+    IndexType mid1_first = thrust::system::detail::internal::merge_path(keys_first1, keys_first2, n1, n2, diag_first, wrapped_comp);
+    IndexType mid1_last  = thrust::system::detail::internal::merge_path(keys_first1, keys_first2, n1, n2, diag_last,  wrapped_comp);
+
+    IndexType mid2_first = diag_first - mid1_first;
+    IndexType mid2_last  = diag_last  - mid1_last;
+
+    thrust::merge_by_key(thrust::seq,
+                         keys_first1 + mid1_first, keys_first1 + mid1_last,
+                         keys_first2 + mid2_first, keys_first2 + mid2_last,
+                         values_first3 + mid1_first,
+                         values_first4 + mid2_first,
+                         keys_result + diag_first,
+                         values_result + diag_first,
+                         comp);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return thrust::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+} // end merge_by_key()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,6 +19,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/detail/allocator_aware_execution_policy.h>
+#include <thrust/detail/execute_with_allocator.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -25,16 +27,141 @@ namespace system
 {
 namespace omp
 {
+
+
+// the loop schedules which may be requested with par.schedule()
+enum schedule_kind
+{
+  schedule_static,
+  schedule_dynamic,
+  schedule_guided
+};
+
+
 namespace detail
 {
 
 
+struct schedule_t
+{
+  // false unless a schedule was attached to the policy
+  bool               is_specified;
+  omp::schedule_kind kind;
+  int                chunk_size;
+};
+
+
+// policies without an attached schedule leave the choice to the backend
+template<typename DerivedPolicy>
+__host__ __device__
+schedule_t get_schedule(const execution_policy<DerivedPolicy> &)
+{
+  schedule_t result = {false, schedule_static, 0};
+  return result;
+}
+
+
+template<typename Derived>
+struct execute_with_schedule_base : thrust::system::omp::detail::execution_policy<Derived>
+{
+private:
+  schedule_t m_schedule;
+
+  // lets execute_with_schedule pass its schedule on to the policy with an allocator
+  template<typename> friend struct execute_with_schedule_base;
+
+public:
+  __host__ __device__
+  execute_with_schedule_base()
+  {
+    m_schedule.is_specified = false;
+    m_schedule.kind         = schedule_static;
+    m_schedule.chunk_size   = 0;
+  }
+
+  // a chunk_size of 0 requests the OpenMP default for kind
+  __host__ __device__
+  Derived schedule(omp::schedule_kind kind, int chunk_size = 0) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.m_schedule.is_specified = true;
+    result.m_schedule.kind         = kind;
+    result.m_schedule.chunk_size   = chunk_size;
+    return result;
+  }
+
+protected:
+  template<typename Policy>
+  __host__ __device__
+  Policy with_schedule_of_this(Policy policy) const
+  {
+    static_cast<execute_with_schedule_base<Policy>&>(policy).m_schedule = m_schedule;
+    return policy;
+  }
+
+private:
+  friend __host__ __device__
+  schedule_t get_schedule(const execute_with_schedule_base &exec)
+  {
+    return exec.m_schedule;
+  }
+};
+
+
+// the policy returned by par.schedule(); like par, it takes an allocator for its
+// temporary storage, e.g. par.schedule(kind)(alloc), and keeps its schedule
+struct execute_with_schedule : execute_with_schedule_base<execute_with_schedule>
+{
+  template<typename Allocator>
+  struct execute_with_allocator_type
+  {
+    typedef thrust::detail::execute_with_allocator<Allocator, execute_with_schedule_base> type;
+  };
+
+  template<typename MemoryResource>
+  __host__
+  typename execute_with_allocator_type<
+    thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>
+  >::type
+    operator()(MemoryResource *mem_res) const
+  {
+    typedef typename execute_with_allocator_type<
+      thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>
+    >::type result_type;
+
+    return this->with_schedule_of_this(result_type(mem_res));
+  }
+
+  template<typename Allocator>
+  __host__
+  typename execute_with_allocator_type<Allocator&>::type
+    operator()(Allocator &alloc) const
+  {
+    return this->with_schedule_of_this(typename execute_with_allocator_type<Allocator&>::type(alloc));
+  }
+
+  template<typename Allocator>
+  __host__
+  typename execute_with_allocator_type<Allocator>::type
+    operator()(const Allocator &alloc) const
+  {
+    return this->with_schedule_of_this(typename execute_with_allocator_type<Allocator>::type(alloc));
+  }
+};
+
+
 struct par_t : thrust::system::omp::detail::execution_policy<par_t>,
   thrust::detail::allocator_aware_execution_policy<
     thrust::system::omp::detail::execution_policy>
 {
   __host__ __device__
   constexpr par_t() : thrust::system::omp::detail::execution_policy<par_t>() {}
+
+  __host__ __device__
+  execute_with_schedule schedule(omp::schedule_kind kind, int chunk_size = 0) const
+  {
+    return execute_with_schedule().schedule(kind, chunk_size);
+  }
 };
 
 
@@ -54,6 +181,10 @@ namespace omp
 
 
 using thrust::system::omp::par;
+using thrust::system::omp::schedule_kind;
+using thrust::system::omp::schedule_static;
+using thrust::system::omp::schedule_dynamic;
+using thrust::system::omp::schedule_guided;
 
 
 } // end omp
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,8 +19,22 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/reduce_by_key.h>
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/count.h>
 #include <thrust/distance.h>
+#include <thrust/pair.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/function_traits.h>
+#include <thrust/detail/range/tail_flags.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -29,6 +44,120 @@ namespace omp
 namespace detail
 {
 
+
+namespace reduce_by_key_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename InputIterator, typename BinaryFunction>
+  struct partial_sum_type
+    : thrust::detail::eval_if<
+        thrust::detail::has_result_type<BinaryFunction>::value,
+        thrust::detail::result_type<BinaryFunction>,
+        thrust::iterator_value<InputIterator>
+      >
+{};
+
+
+// reduces the segment which continues past the end of the tile [b, e), if any,
+// to a carry; returns the index of the first element of that segment, or -1
+// if the tile has no carry
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename IndexType,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  IndexType reduce_tile_carry(InputIterator1 keys_first,
+                              InputIterator2 values_first,
+                              IndexType b,
+                              IndexType e,
+                              IndexType n,
+                              ValueType &carry,
+                              BinaryPredicate binary_pred,
+                              BinaryFunction binary_op)
+{
+  if(e == n || !binary_pred(keys_first[e - 1], keys_first[e]))
+  {
+    return IndexType(-1);
+  }
+
+  // consume the last segment of the tile backward
+  IndexType carry_first = e - 1;
+  carry = values_first[carry_first];
+
+  while(carry_first > b && binary_pred(keys_first[carry_first - 1], keys_first[carry_first]))
+  {
+    --carry_first;
+    carry = binary_op(values_first[carry_first], carry);
+  }
+
+  return carry_first;
+} // end reduce_tile_carry()
+
+
+// reduces the segments which end in the tile [b, e), none of which continues
+// past carry_first, to the output; if head_first isn't -1, the first of them
+// begins at head_first, in a tile before this one, and the elements of it
+// before b reduce to incoming
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename TailFlagIterator,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename IndexType,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  void reduce_tile(InputIterator1 keys_first,
+                   InputIterator2 values_first,
+                   TailFlagIterator tail_flags,
+                   IndexType b,
+                   IndexType carry_first,
+                   IndexType head_first,
+                   const ValueType &incoming,
+                   OutputIterator1 keys_output,
+                   OutputIterator2 values_output,
+                   BinaryPredicate binary_pred,
+                   BinaryFunction binary_op)
+{
+  if(head_first >= 0)
+  {
+    // finish the segment begun before the tile
+    ValueType sum = incoming;
+
+    for(; b < carry_first; ++b)
+    {
+      sum = binary_op(sum, values_first[b]);
+
+      if(tail_flags[b])
+      {
+        ++b;
+        break;
+      }
+    }
+
+    *keys_output   = keys_first[head_first];
+    *values_output = sum;
+    ++keys_output;
+    ++values_output;
+  }
+
+  thrust::reduce_by_key(thrust::seq,
+                        keys_first + b, keys_first + carry_first,
+                        values_first + b,
+                        keys_output, values_output,
+                        binary_pred, binary_op);
+} // end reduce_tile()
+
+
+} // end reduce_by_key_detail
+
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -46,8 +175,125 @@ template <typename DerivedPolicy,
                   BinaryPredicate binary_pred,
                   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<InputIterator1>::type                   IndexType;
+  typedef typename reduce_by_key_detail::partial_sum_type<InputIterator2,BinaryFunction>::type ValueType;
+
+  const IndexType n = thrust::distance(keys_first, keys_last);
+
+  if(n < reduce_by_key_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::reduce_by_key(thrust::seq, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_pred and binary_op
+  thrust::detail::wrapped_function<BinaryPredicate,bool>     wrapped_binary_pred(binary_pred);
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  IndexType num_tiles = decomp.size();
+
+  // the output offset of every tile, followed by the first element of every tile's carried segment,
+  // and by the first element of the segment every tile continues, if any
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> indices_storage(exec, 3 * num_tiles + 1);
+  IndexType *offsets      = thrust::raw_pointer_cast(indices_storage.data());
+  IndexType *carry_firsts = offsets + num_tiles + 1;
+  IndexType *head_firsts  = carry_firsts + num_tiles;
+
+  // the partial sum of every tile's carried segment, and of the segment every tile continues
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries_storage(exec, 2 * num_tiles);
+  ValueType *carries  = thrust::raw_pointer_cast(carries_storage.data());
+  ValueType *incoming = carries + num_tiles;
+
+  // every segment is written by the tile containing its last element
+  thrust::detail::tail_flags<InputIterator1,thrust::detail::wrapped_function<BinaryPredicate,bool> > tail_flags =
+    thrust::detail::make_tail_flags(keys_first, keys_last, wrapped_binary_pred);
+
+  // count the segments which end in every tile, and reduce the segment every tile carries past its end
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    offsets[i] = thrust::count(thrust::seq,
+                               tail_flags.begin() + decomp[i].begin(),
+                               tail_flags.begin() + decomp[i].end(),
+                               true);
+
+    carry_firsts[i] = reduce_by_key_detail::reduce_tile_carry(keys_first,
+                                                               values_first,
+                                                               decomp[i].begin(),
+                                                               decomp[i].end(),
+                                                               n,
+                                                               carries[i],
+                                                               wrapped_binary_pred,
+                                                               wrapped_binary_op);
+  }
+
+  offsets[num_tiles] = 0;
+  thrust::exclusive_scan(thrust::seq, offsets, offsets + num_tiles + 1, offsets);
+
+  // pass the carries on in input order; a tile in which no segment ends lies
+  // within the segment it continues, so its carry grows and moves on
+  head_firsts[0] = -1;
+  for(IndexType i = 0; i + 1 < num_tiles; ++i)
+  {
+    if(carry_firsts[i] < 0)
+    {
+      head_firsts[i + 1] = -1;
+    }
+    else if(head_firsts[i] >= 0 && offsets[i] == offsets[i + 1])
+    {
+      head_firsts[i + 1] = head_firsts[i];
+      incoming[i + 1]    = wrapped_binary_op(incoming[i], carries[i]);
+    }
+    else
+    {
+      head_firsts[i + 1] = carry_firsts[i];
+      incoming[i + 1]    = carries[i];
+    }
+  }
+
+  // write the segments which end in every tile, each output exactly once
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    if(offsets[i] == offsets[i + 1]) continue;
+
+    reduce_by_key_detail::reduce_tile(keys_first,
+                                      values_first,
+                                      tail_flags.begin(),
+                                      decomp[i].begin(),
+                                      carry_firsts[i] < 0 ? decomp[i].end() : carry_firsts[i],
+                                      head_firsts[i],
+                                      incoming[i],
+                                      keys_output + offsets[i],
+                                      values_output + offsets[i],
+                                      wrapped_binary_pred,
+                                      wrapped_binary_op);
+  }
+
+  return thrust::make_pair(keys_output + offsets[num_tiles], values_output + offsets[num_tiles]);
+#else
+  return thrust::make_pair(keys_output, values_output);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 } // end reduce_by_key()
 
 
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,7 +19,20 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/remove.h>
+#include <thrust/system/omp/detail/copy_if.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/omp/detail/compact_tiles.h>
+#include <thrust/distance.h>
+#include <thrust/remove.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -36,8 +50,55 @@ template<typename DerivedPolicy,
                             ForwardIterator last,
                             Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::remove_if(thrust::seq, first, last, pred);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap pred
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  IndexType num_tiles = decomp.size();
+
+  // the range kept by each tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> kept_storage(exec, 2 * num_tiles);
+  IndexType *kept_begins = thrust::raw_pointer_cast(kept_storage.data());
+  IndexType *kept_ends   = kept_begins + num_tiles;
+
+  // compact every tile to its front
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    kept_begins[i] = decomp[i].begin();
+    kept_ends[i]   = thrust::remove_if(thrust::seq,
+                                       first + decomp[i].begin(),
+                                       first + decomp[i].end(),
+                                       wrapped_pred) - first;
+  }
+
+  return thrust::system::omp::detail::shift_compacted_tiles(exec, first, kept_begins, kept_ends, num_tiles);
+#else
+  return last;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 
@@ -51,8 +112,56 @@ template<typename DerivedPolicy,
                             InputIterator stencil,
                             Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::remove_if(thrust::seq, first, last, stencil, pred);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap pred
+  thrust::detail::wrapped_function<Predicate,bool> wrapped_pred(pred);
+
+  IndexType num_tiles = decomp.size();
+
+  // the range kept by each tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> kept_storage(exec, 2 * num_tiles);
+  IndexType *kept_begins = thrust::raw_pointer_cast(kept_storage.data());
+  IndexType *kept_ends   = kept_begins + num_tiles;
+
+  // compact every tile to its front
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    kept_begins[i] = decomp[i].begin();
+    kept_ends[i]   = thrust::remove_if(thrust::seq,
+                                       first + decomp[i].begin(),
+                                       first + decomp[i].end(),
+                                       stencil + decomp[i].begin(),
+                                       wrapped_pred) - first;
+  }
+
+  return thrust::system::omp::detail::shift_compacted_tiles(exec, first, kept_begins, kept_ends, num_tiles);
+#else
+  return last;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 
@@ -66,8 +175,8 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
+  // omp::copy_if needs no stencil-sized scratch, unlike generic::remove_copy_if
+  return thrust::system::omp::detail::copy_if(exec, first, last, first, result, thrust::detail::not1(pred));
 }
 
 template<typename DerivedPolicy,
@@ -82,8 +191,8 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
+  // omp::copy_if needs no stencil-sized scratch, unlike generic::remove_copy_if
+  return thrust::system::omp::detail::copy_if(exec, first, last, stencil, result, thrust::detail::not1(pred));
 }
 
 } // end namespace detail
@@ -0,0 +1,247 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/distance.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+// inclusive scan of a single tile, seeded with the sum of all preceding tiles
+template<typename InputIterator,
+         typename OutputIterator,
+         typename ValueType,
+         typename BinaryFunction>
+void inclusive_scan_tile(InputIterator first,
+                         InputIterator last,
+                         OutputIterator result,
+                         ValueType sum,
+                         BinaryFunction binary_op)
+{
+  for(; first != last; ++first, ++result)
+  {
+    sum = binary_op(sum, *first);
+    *result = sum;
+  }
+}
+
+
+// exclusive scan of a single tile, seeded with the sum of all preceding tiles
+template<typename InputIterator,
+         typename OutputIterator,
+         typename ValueType,
+         typename BinaryFunction>
+void exclusive_scan_tile(InputIterator first,
+                         InputIterator last,
+                         OutputIterator result,
+                         ValueType sum,
+                         BinaryFunction binary_op)
+{
+  for(; first != last; ++first, ++result)
+  {
+    ValueType tmp = *first;  // temporary value allows in-situ scan
+    *result = sum;
+    sum = binary_op(sum, tmp);
+  }
+}
+
+
+} // end namespace scan_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  typedef typename thrust::iterator_value<InputIterator>::type      ValueType;
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(n < scan_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile gains nothing from the three-phase scan
+  if(decomp.size() <= 1)
+  {
+    return thrust::inclusive_scan(thrust::seq, first, last, result, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  // reduce each tile to a single value
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+  // scan the tile sums so that carries[i] holds the sum of tiles [0, i]
+  thrust::inclusive_scan(thrust::seq, carries.begin(), carries.end(), carries.begin(), binary_op);
+
+  // rescan every tile, seeded with the carry of the tiles which precede it
+  IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    InputIterator  tile_first  = first  + decomp[i].begin();
+    InputIterator  tile_last   = first  + decomp[i].end();
+    OutputIterator tile_result = result + decomp[i].begin();
+
+    if(i == 0)
+    {
+      thrust::inclusive_scan(thrust::seq, tile_first, tile_last, tile_result, binary_op);
+    }
+    else
+    {
+      ValueType carry = carries.begin()[i - 1];
+      scan_detail::inclusive_scan_tile(tile_first, tile_last, tile_result, carry, wrapped_binary_op);
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+} // end inclusive_scan()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename OutputIterator,
+         typename InitialValueType,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
+                                InputIterator first,
+                                InputIterator last,
+                                OutputIterator result,
+                                InitialValueType init,
+                                BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  // Use the initial value type per https://wg21.link/P0571
+  typedef InitialValueType                                          ValueType;
+  typedef typename thrust::iterator_difference<InputIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(n < scan_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile gains nothing from the three-phase scan
+  if(decomp.size() <= 1)
+  {
+    return thrust::exclusive_scan(thrust::seq, first, last, result, init, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  // reduce each tile to a single value
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> carries(exec, decomp.size());
+  thrust::system::omp::detail::reduce_intervals(exec, first, carries.begin(), binary_op, decomp);
+
+  // scan the tile sums so that carries[i] holds init plus the sum of tiles [0, i)
+  thrust::exclusive_scan(thrust::seq, carries.begin(), carries.end(), carries.begin(), init, binary_op);
+
+  // rescan every tile, seeded with the carry of the tiles which precede it
+  IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    InputIterator  tile_first  = first  + decomp[i].begin();
+    InputIterator  tile_last   = first  + decomp[i].end();
+    OutputIterator tile_result = result + decomp[i].begin();
+
+    ValueType carry = carries.begin()[i];
+    scan_detail::exclusive_scan_tile(tile_first, tile_last, tile_result, carry, wrapped_binary_op);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+} // end exclusive_scan()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
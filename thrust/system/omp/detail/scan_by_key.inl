@@ -0,0 +1,218 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/scan_by_key.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/internal/scan_by_key_tiles.h>
+#include <thrust/distance.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+} // end scan_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_traits<InputIterator2>::value_type ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type   IndexType;
+
+  const IndexType n = thrust::distance(first1, last1);
+
+  if(n < scan_by_key_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile gains nothing from the three-phase scan
+  if(decomp.size() <= 1)
+  {
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType> carry_type;
+
+  IndexType num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<carry_type,DerivedPolicy> carries_storage(exec, num_tiles);
+  carry_type *carries = thrust::raw_pointer_cast(carries_storage.data());
+
+  // reduce the last segment of each tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    carries[i] = thrust::system::detail::internal::reduce_scan_by_key_tile(
+      first1, first2, decomp[i].begin(), decomp[i].end(), static_cast<const ValueType*>(0), binary_pred, wrapped_binary_op);
+  }
+
+  thrust::system::detail::internal::propagate_scan_by_key_carries(carries, num_tiles, wrapped_binary_op);
+
+  // rescan every tile, seeded with the sum of the segment which is open on entry to it
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::inclusive_scan_by_key_tile(
+      first1, first2, result, decomp[i].begin(), decomp[i].end(), carries[i], binary_pred, wrapped_binary_op);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+} // end inclusive_scan_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       T init,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef T                                                            ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type   IndexType;
+
+  const IndexType n = thrust::distance(first1, last1);
+
+  if(n < scan_by_key_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  // a single tile gains nothing from the three-phase scan
+  if(decomp.size() <= 1)
+  {
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_op
+  thrust::detail::wrapped_function<BinaryFunction,ValueType> wrapped_binary_op(binary_op);
+
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType> carry_type;
+
+  IndexType num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<carry_type,DerivedPolicy> carries_storage(exec, num_tiles);
+  carry_type *carries = thrust::raw_pointer_cast(carries_storage.data());
+
+  const ValueType head_init = init;
+
+  // reduce the last segment of each tile, seeding every segment with init
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    carries[i] = thrust::system::detail::internal::reduce_scan_by_key_tile(
+      first1, first2, decomp[i].begin(), decomp[i].end(), &head_init, binary_pred, wrapped_binary_op);
+  }
+
+  thrust::system::detail::internal::propagate_scan_by_key_carries(carries, num_tiles, wrapped_binary_op);
+
+  // rescan every tile, seeded with the sum of the segment which is open on entry to it
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::exclusive_scan_by_key_tile(
+      first1, first2, result, decomp[i].begin(), decomp[i].end(), carries[i], head_init, binary_pred, wrapped_binary_op);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return result + n;
+} // end exclusive_scan_by_key()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -45,6 +46,45 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
                         RandomAccessIterator2 values_first,
                         StrictWeakOrdering comp);
 
+// sort and sort_by_key use the parallel stable sorts rather than the
+// sequential in-place radix sort the policy would otherwise inherit
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp);
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void sort_by_key(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 StrictWeakOrdering comp);
+
+// sorts by the bits [begin_bit, end_bit) of the keys with the parallel radix passes
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+void sort(execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          unsigned int begin_bit,
+          unsigned int end_bit);
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+void sort_by_key(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 unsigned int begin_bit,
+                 unsigned int end_bit);
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -26,10 +27,18 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/radix_sort_tiles.h>
 #include <thrust/sort.h>
 #include <thrust/merge.h>
+#include <thrust/copy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/raw_pointer_cast.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -42,21 +51,347 @@ namespace sort_detail
 {
 
 
+// returns the offset of the first element of tile i, or n past the last tile
+template<typename Decomposition>
+typename Decomposition::index_type tile_begin(const Decomposition &decomp,
+                                              typename Decomposition::index_type n,
+                                              typename Decomposition::index_type i)
+{
+  return i < decomp.size() ? decomp[i].begin() : n;
+}
+
+
+// merges every pair of adjacent runs of width tiles from src into dst;
+// each thread produces the output positions of its own tile, so all threads
+// participate in every round regardless of how many runs remain
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition,
+         typename StrictWeakOrdering>
+void merge_round(RandomAccessIterator1 src,
+                 RandomAccessIterator2 dst,
+                 typename Decomposition::index_type n,
+                 const Decomposition &decomp,
+                 typename Decomposition::index_type width,
+                 typename Decomposition::index_type p_i,
+                 StrictWeakOrdering comp)
+{
+  typedef typename Decomposition::index_type IndexType;
+
+  const IndexType num_tiles = decomp.size();
+  const IndexType diag_first = decomp[p_i].begin();
+  const IndexType diag_last  = decomp[p_i].end();
+
+  for(IndexType tile = 0; tile < num_tiles; tile += 2 * width)
+  {
+    IndexType run_first = tile_begin(decomp, n, tile);
+    IndexType run_mid   = tile_begin(decomp, n, thrust::min<IndexType>(tile + width, num_tiles));
+    IndexType run_last  = tile_begin(decomp, n, thrust::min<IndexType>(tile + 2 * width, num_tiles));
+
+    if(run_last <= diag_first) continue;
+    if(run_first >= diag_last) break;
+
+    IndexType n1 = run_mid  - run_first;
+    IndexType n2 = run_last - run_mid;
+
+    // the portion of this merge which lands in our tile
+    IndexType d0 = thrust::max<IndexType>(diag_first, run_first) - run_first;
+    IndexType d1 = thrust::min<IndexType>(diag_last,  run_last)  - run_first;
+
+    IndexType i0 = thrust::system::detail::internal::merge_path(src + run_first, src + run_mid, n1, n2, d0, comp);
+    IndexType i1 = thrust::system::detail::internal::merge_path(src + run_first, src + run_mid, n1, n2, d1, comp);
+
+    thrust::merge(thrust::seq,
+                  src + run_first + i0, src + run_first + i1,
+                  src + run_mid + (d0 - i0), src + run_mid + (d1 - i1),
+                  dst + run_first + d0,
+                  comp);
+  }
+}
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition,
+         typename StrictWeakOrdering>
+void merge_by_key_round(RandomAccessIterator1 keys_src,
+                        RandomAccessIterator2 values_src,
+                        RandomAccessIterator3 keys_dst,
+                        RandomAccessIterator4 values_dst,
+                        typename Decomposition::index_type n,
+                        const Decomposition &decomp,
+                        typename Decomposition::index_type width,
+                        typename Decomposition::index_type p_i,
+                        StrictWeakOrdering comp)
+{
+  typedef typename Decomposition::index_type IndexType;
+
+  const IndexType num_tiles = decomp.size();
+  const IndexType diag_first = decomp[p_i].begin();
+  const IndexType diag_last  = decomp[p_i].end();
+
+  for(IndexType tile = 0; tile < num_tiles; tile += 2 * width)
+  {
+    IndexType run_first = tile_begin(decomp, n, tile);
+    IndexType run_mid   = tile_begin(decomp, n, thrust::min<IndexType>(tile + width, num_tiles));
+    IndexType run_last  = tile_begin(decomp, n, thrust::min<IndexType>(tile + 2 * width, num_tiles));
+
+    if(run_last <= diag_first) continue;
+    if(run_first >= diag_last) break;
+
+    IndexType n1 = run_mid  - run_first;
+    IndexType n2 = run_last - run_mid;
+
+    // the portion of this merge which lands in our tile
+    IndexType d0 = thrust::max<IndexType>(diag_first, run_first) - run_first;
+    IndexType d1 = thrust::min<IndexType>(diag_last,  run_last)  - run_first;
+
+    IndexType i0 = thrust::system::detail::internal::merge_path(keys_src + run_first, keys_src + run_mid, n1, n2, d0, comp);
+    IndexType i1 = thrust::system::detail::internal::merge_path(keys_src + run_first, keys_src + run_mid, n1, n2, d1, comp);
+
+    thrust::merge_by_key(thrust::seq,
+                         keys_src + run_first + i0, keys_src + run_first + i1,
+                         keys_src + run_mid + (d0 - i0), keys_src + run_mid + (d1 - i1),
+                         values_src + run_first + i0, values_src + run_mid + (d0 - i0),
+                         keys_dst + run_first + d0, values_dst + run_first + d0,
+                         comp);
+  }
+}
+
+
+// XXX this value is a tuning opportunity
+const int radix_sort_threshold = 1 << 16;
+
+
+// sorts the keys of src by the digit of pass into dst;
+// returns false without writing dst if the pass would not move any key
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition>
+bool radix_sort_pass(RandomAccessIterator1 src,
+                     RandomAccessIterator2 dst,
+                     typename Decomposition::index_type n,
+                     const Decomposition &decomp,
+                     thrust::system::detail::internal::radix_pass pass,
+                     typename Decomposition::index_type *counts)
+{
+  typedef typename Decomposition::index_type                          IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<KeyType>::num_buckets;
+  const IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_count_tile<Descending>(src, decomp[i].begin(), decomp[i].end(), pass, counts + i * num_buckets);
+  }
+
+  if(!thrust::system::detail::internal::radix_scan_counts<num_buckets>(counts, num_tiles, n))
+  {
+    return false;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_scatter_tile<Descending>(src, decomp[i].begin(), decomp[i].end(), pass, counts + i * num_buckets, dst);
+  }
+
+  return true;
+}
+
+
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition>
+bool radix_sort_by_key_pass(RandomAccessIterator1 keys_src,
+                            RandomAccessIterator2 values_src,
+                            RandomAccessIterator3 keys_dst,
+                            RandomAccessIterator4 values_dst,
+                            typename Decomposition::index_type n,
+                            const Decomposition &decomp,
+                            thrust::system::detail::internal::radix_pass pass,
+                            typename Decomposition::index_type *counts)
+{
+  typedef typename Decomposition::index_type                          IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<KeyType>::num_buckets;
+  const IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_count_tile<Descending>(keys_src, decomp[i].begin(), decomp[i].end(), pass, counts + i * num_buckets);
+  }
+
+  if(!thrust::system::detail::internal::radix_scan_counts<num_buckets>(counts, num_tiles, n))
+  {
+    return false;
+  }
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::system::detail::internal::radix_scatter_by_key_tile<Descending>(keys_src, values_src, decomp[i].begin(), decomp[i].end(), pass, counts + i * num_buckets, keys_dst, values_dst);
+  }
+
+  return true;
+}
+
+
+// sorts [first, first + n) by the bits [begin_bit, end_bit) of its keys
+template<bool Descending,
+         typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Decomposition>
+void radix_sort(execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator first,
+                typename Decomposition::index_type n,
+                const Decomposition &decomp,
+                unsigned int begin_bit,
+                unsigned int end_bit)
+{
+  typedef typename Decomposition::index_type                          IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType> traits;
+
+  end_bit = thrust::min<unsigned int>(end_bit, traits::key_bits);
+
+  if(begin_bit >= end_bit)
+  {
+    return;
+  }
+
+  // the passes ping-pong between the input and this buffer
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> buffer(exec, n);
+  KeyType *buf = thrust::raw_pointer_cast(buffer.data());
+
+  // one histogram of digits per tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> counts_storage(exec, decomp.size() * traits::num_buckets);
+  IndexType *counts = thrust::raw_pointer_cast(counts_storage.data());
+
+  bool in_buffer = false;
+
+  for(unsigned int shift = begin_bit; shift < end_bit; shift += traits::radix_bits)
+  {
+    thrust::system::detail::internal::radix_pass pass = thrust::system::detail::internal::make_radix_pass<KeyType>(shift, end_bit);
+
+    bool moved = in_buffer ?
+      radix_sort_pass<Descending>(buf, first, n, decomp, pass, counts) :
+      radix_sort_pass<Descending>(first, buf, n, decomp, pass, counts);
+
+    if(moved)
+    {
+      in_buffer = !in_buffer;
+    }
+  }
+
+  if(in_buffer)
+  {
+    thrust::copy(exec, buf, buf + n, first);
+  }
+}
+
+
+template<bool Descending,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition>
+void radix_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator1 keys_first,
+                       RandomAccessIterator2 values_first,
+                       typename Decomposition::index_type n,
+                       const Decomposition &decomp,
+                       unsigned int begin_bit,
+                       unsigned int end_bit)
+{
+  typedef typename Decomposition::index_type                           IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType>  traits;
+
+  end_bit = thrust::min<unsigned int>(end_bit, traits::key_bits);
+
+  if(begin_bit >= end_bit)
+  {
+    return;
+  }
+
+  // the passes ping-pong between the input and these buffers
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   keys_buffer(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> values_buffer(exec, n);
+  KeyType   *keys_buf   = thrust::raw_pointer_cast(keys_buffer.data());
+  ValueType *values_buf = thrust::raw_pointer_cast(values_buffer.data());
+
+  // one histogram of digits per tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> counts_storage(exec, decomp.size() * traits::num_buckets);
+  IndexType *counts = thrust::raw_pointer_cast(counts_storage.data());
+
+  bool in_buffer = false;
+
+  for(unsigned int shift = begin_bit; shift < end_bit; shift += traits::radix_bits)
+  {
+    thrust::system::detail::internal::radix_pass pass = thrust::system::detail::internal::make_radix_pass<KeyType>(shift, end_bit);
+
+    bool moved = in_buffer ?
+      radix_sort_by_key_pass<Descending>(keys_buf, values_buf, keys_first, values_first, n, decomp, pass, counts) :
+      radix_sort_by_key_pass<Descending>(keys_first, values_first, keys_buf, values_buf, n, decomp, pass, counts);
+
+    if(moved)
+    {
+      in_buffer = !in_buffer;
+    }
+  }
+
+  if(in_buffer)
+  {
+    thrust::copy(exec, keys_buf,   keys_buf   + n, keys_first);
+    thrust::copy(exec, values_buf, values_buf + n, values_first);
+  }
+}
+
+
+////////////////
+// Radix Sort //
+////////////////
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy> &exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator>::type value_type;
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType>     traits;
 
-  thrust::detail::temporary_array<value_type,DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type,DerivedPolicy> b(exec, middle, last);
+  const bool descending = thrust::system::detail::internal::radix_sort_is_descending<KeyType,StrictWeakOrdering>::value;
+
+  const IndexType n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(n < radix_sort_threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+  sort_detail::radix_sort<descending>(exec, first, n, decomp, 0, traits::key_bits);
 }
 
 
@@ -64,34 +399,37 @@ template<typename DerivedPolicy,
          typename RandomAccessIterator1,
          typename RandomAccessIterator2,
          typename StrictWeakOrdering>
-void inplace_merge_by_key(execution_policy<DerivedPolicy> &exec,
-                          RandomAccessIterator1 first1,
-                          RandomAccessIterator1 middle1,
-                          RandomAccessIterator1 last1,
-                          RandomAccessIterator2 first2,
-                          StrictWeakOrdering comp)
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp,
+                        thrust::detail::true_type)
 {
-  typedef typename thrust::iterator_value<RandomAccessIterator1>::type value_type1;
-  typedef typename thrust::iterator_value<RandomAccessIterator2>::type value_type2;
-
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1   - first1);
-
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1,DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2,DerivedPolicy> rhs2(exec, middle2, last2);
-
-  thrust::merge_by_key(thrust::seq,
-                       lhs1.begin(), lhs1.end(),
-                       rhs1.begin(), rhs1.end(),
-                       lhs2.begin(), rhs2.begin(),
-                       first1, first2,
-                       comp);
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType>      traits;
+
+  const bool descending = thrust::system::detail::internal::radix_sort_is_descending<KeyType,StrictWeakOrdering>::value;
+
+  const IndexType n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(n < radix_sort_threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  sort_detail::radix_sort_by_key<descending>(exec, keys_first, values_first, n, decomp, 0, traits::key_bits);
 }
 
 
-} // end sort_detail
+////////////////
+// Merge Sort //
+////////////////
 
 
 template<typename DerivedPolicy,
@@ -100,30 +438,35 @@ template<typename DerivedPolicy,
 void stable_sort(execution_policy<DerivedPolicy> &exec,
                  RandomAccessIterator first,
                  RandomAccessIterator last,
-                 StrictWeakOrdering comp)
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<
-      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-    >::value)
-  , "OpenMP compiler support is not enabled"
-  );
-
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      value_type;
 
   if(first == last)
     return;
 
+  const IndexType n = last - first;
+
+  if(n == 1 || omp_get_max_threads() == 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  // the merge rounds ping-pong between the input and this buffer
+  thrust::detail::temporary_array<value_type,DerivedPolicy> buffer(exec, n);
+  value_type *buf = thrust::raw_pointer_cast(buffer.data());
+
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
   THRUST_PRAGMA_OMP(parallel)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, omp_get_num_threads());
 
     // process id
     IndexType p_i = omp_get_thread_num();
@@ -142,34 +485,35 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
+    bool in_buffer = false;
 
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
-
-    while(nseg>1)
+    for(IndexType width = 1; width < decomp.size(); width *= 2)
     {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
-
-      if((p_i % h) == 0 && c > b)
+      if(p_i < decomp.size())
       {
-        sort_detail::inplace_merge(exec,
-                                   first + decomp[a].begin(),
-                                   first + decomp[b].end(),
-                                   first + decomp[c].end(),
-                                   comp);
-
-        b = c;
-        c += h;
+        if(in_buffer)
+        {
+          sort_detail::merge_round(buf, first, n, decomp, width, p_i, wrapped_comp);
+        }
+        else
+        {
+          sort_detail::merge_round(first, buf, n, decomp, width, p_i, wrapped_comp);
+        }
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_buffer = !in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    // move the result back into place if the last round left it in the buffer
+    if(in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   buf + decomp[p_i].begin(),
+                   buf + decomp[p_i].end(),
+                   first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -183,30 +527,38 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
                         RandomAccessIterator1 keys_first,
                         RandomAccessIterator1 keys_last,
                         RandomAccessIterator2 values_first,
-                        StrictWeakOrdering comp)
+                        StrictWeakOrdering comp,
+                        thrust::detail::false_type)
 {
-  // we're attempting to launch an omp kernel, assert we're compiling with omp support
-  // ========================================================================
-  // X Note to the user: If you've found this line due to a compiler error, X
-  // X you need to enable OpenMP support in your compiler.                  X
-  // ========================================================================
-  THRUST_STATIC_ASSERT_MSG(
-    (thrust::detail::depend_on_instantiation<
-      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-    >::value)
-  , "OpenMP compiler support is not enabled"
-  );
-
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      value_type1;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      value_type2;
 
   if(keys_first == keys_last)
     return;
 
+  const IndexType n = keys_last - keys_first;
+
+  if(n == 1 || omp_get_max_threads() == 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  // the merge rounds ping-pong between the input and these buffers
+  thrust::detail::temporary_array<value_type1,DerivedPolicy> keys_buffer(exec, n);
+  thrust::detail::temporary_array<value_type2,DerivedPolicy> values_buffer(exec, n);
+  value_type1 *keys_buf   = thrust::raw_pointer_cast(keys_buffer.data());
+  value_type2 *values_buf = thrust::raw_pointer_cast(values_buffer.data());
+
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering,bool> wrapped_comp(comp);
+
   THRUST_PRAGMA_OMP(parallel)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(keys_last - keys_first, 1, omp_get_num_threads());
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, omp_get_num_threads());
 
     // process id
     IndexType p_i = omp_get_thread_num();
@@ -226,40 +578,215 @@ void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
     // XXX For some reason, MSVC 2015 yields an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h = 2;
+    bool in_buffer = false;
 
-    // keep track of which sub-range we're processing
-    IndexType a=p_i, b=p_i, c=p_i+1;
-
-    while(nseg>1)
+    for(IndexType width = 1; width < decomp.size(); width *= 2)
     {
-      if(c >= decomp.size())
-        c = decomp.size() - 1;
-
-      if((p_i % h) == 0 && c > b)
+      if(p_i < decomp.size())
       {
-        sort_detail::inplace_merge_by_key(exec,
-                                          keys_first + decomp[a].begin(),
-                                          keys_first + decomp[b].end(),
-                                          keys_first + decomp[c].end(),
-                                          values_first + decomp[a].begin(),
-                                          comp);
-
-        b = c;
-        c += h;
+        if(in_buffer)
+        {
+          sort_detail::merge_by_key_round(keys_buf, values_buf, keys_first, values_first, n, decomp, width, p_i, wrapped_comp);
+        }
+        else
+        {
+          sort_detail::merge_by_key_round(keys_first, values_first, keys_buf, values_buf, n, decomp, width, p_i, wrapped_comp);
+        }
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_buffer = !in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
     }
+
+    // move the result back into place if the last round left it in the buffers
+    if(in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   keys_buf + decomp[p_i].begin(),
+                   keys_buf + decomp[p_i].end(),
+                   keys_first + decomp[p_i].begin());
+      thrust::copy(thrust::seq,
+                   values_buf + decomp[p_i].begin(),
+                   values_buf + decomp[p_i].end(),
+                   values_first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 
 
+} // end sort_detail
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  thrust::system::detail::internal::use_radix_sort<KeyType,StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  thrust::system::detail::internal::use_radix_sort<KeyType,StrictWeakOrdering> use_radix_sort;
+
+  sort_detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp, use_radix_sort);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp)
+{
+  thrust::system::omp::detail::stable_sort(exec, first, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void sort_by_key(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 StrictWeakOrdering comp)
+{
+  thrust::system::omp::detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+void sort(execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          unsigned int begin_bit,
+          unsigned int end_bit)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<KeyType>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  const IndexType n = last - first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(n < sort_detail::radix_sort_threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::sort(thrust::seq, first, last, begin_bit, end_bit);
+    return;
+  }
+
+  sort_detail::radix_sort<false>(exec, first, n, decomp, begin_bit, end_bit);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+void sort_by_key(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator1 keys_first,
+                 RandomAccessIterator1 keys_last,
+                 RandomAccessIterator2 values_first,
+                 unsigned int begin_bit,
+                 unsigned int end_bit)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      RandomAccessIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<KeyType>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  const IndexType n = keys_last - keys_first;
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(n < sort_detail::radix_sort_threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::sort_by_key(thrust::seq, keys_first, keys_last, values_first, begin_bit, end_bit);
+    return;
+  }
+
+  sort_detail::radix_sort_by_key<false>(exec, keys_first, values_first, n, decomp, begin_bit, end_bit);
+}
+
+
 } // end namespace detail
 } // end namespace omp
 } // end namespace system
@@ -18,6 +18,7 @@
 
 #include <thrust/detail/config.h>
 
-// this system inherits transform_scan
-#include <thrust/system/cpp/detail/transform_scan.h>
+// this system has no special version of this algorithm:
+// generic::transform_scan wraps the input in a transform_iterator
+// and dispatches to omp's parallel scan
 
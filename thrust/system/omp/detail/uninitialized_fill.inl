@@ -0,0 +1,151 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/omp/detail/uninitialized_fill.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/detail/generic/uninitialized_fill.h>
+#include <thrust/uninitialized_fill.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace omp
+{
+namespace detail
+{
+namespace uninitialized_fill_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x,
+                                       thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::uninitialized_fill_n(exec, first, n, x);
+}
+
+
+// constructs every tile of the default decomposition on its own thread, so the
+// pages of a newly allocated omp::vector are first touched by, and placed on the
+// NUMA node of, the threads which later process the same tiles
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x,
+                                       thrust::random_access_traversal_tag)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType signed_n = n;
+
+  if(signed_n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::uninitialized_fill_n(thrust::seq, first, n, x);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(signed_n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::uninitialized_fill_n(thrust::seq, first, n, x);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  IndexType num_tiles = decomp.size();
+
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    thrust::uninitialized_fill_n(thrust::seq, first + decomp[i].begin(), decomp[i].size(), x);
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return first + signed_n;
+}
+
+
+} // end uninitialized_fill_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+  void uninitialized_fill(execution_policy<DerivedPolicy> &exec,
+                          ForwardIterator first,
+                          ForwardIterator last,
+                          const T &x)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  uninitialized_fill_detail::uninitialized_fill_n(exec, first, thrust::distance(first, last), x, traversal());
+} // end uninitialized_fill()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return uninitialized_fill_detail::uninitialized_fill_n(exec, first, n, x, traversal());
+} // end uninitialized_fill_n()
+
+
+} // end namespace detail
+} // end namespace omp
+} // end namespace system
+THRUST_NAMESPACE_END
+
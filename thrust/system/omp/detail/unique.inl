@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,8 +19,19 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/omp/detail/unique.h>
+#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/omp/detail/compact_tiles.h>
+#include <thrust/distance.h>
 #include <thrust/pair.h>
+#include <thrust/unique.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -38,8 +50,64 @@ template<typename DerivedPolicy,
                          ForwardIterator last,
                          BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec,first,last,binary_pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  THRUST_STATIC_ASSERT_MSG(
+    (thrust::detail::depend_on_instantiation<
+      ForwardIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    >::value)
+  , "OpenMP compiler support is not enabled"
+  );
+
+  typedef typename thrust::iterator_difference<ForwardIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::omp::detail::default_decomposition(n);
+
+  if(decomp.size() <= 1)
+  {
+    return thrust::unique(thrust::seq, first, last, binary_pred);
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  // wrap binary_pred
+  thrust::detail::wrapped_function<BinaryPredicate,bool> wrapped_binary_pred(binary_pred);
+
+  IndexType num_tiles = decomp.size();
+
+  // the range kept by each tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> kept_storage(exec, 2 * num_tiles);
+  IndexType *kept_begins = thrust::raw_pointer_cast(kept_storage.data());
+  IndexType *kept_ends   = kept_begins + num_tiles;
+
+  // a tile drops its first element when it continues the run the tile before it ends with;
+  // decide this before any tile is compacted over its last element
+  kept_begins[0] = 0;
+  for(IndexType i = 1; i < num_tiles; ++i)
+  {
+    const IndexType b = decomp[i].begin();
+
+    kept_begins[i] = wrapped_binary_pred(first[b - 1], first[b]) ? b + 1 : b;
+  }
+
+  // compact every tile to its front
+  THRUST_PRAGMA_OMP(parallel for)
+  for(IndexType i = 0; i < num_tiles; ++i)
+  {
+    kept_ends[i] = thrust::unique(thrust::seq,
+                                  first + decomp[i].begin(),
+                                  first + decomp[i].end(),
+                                  wrapped_binary_pred) - first;
+  }
+
+  return thrust::system::omp::detail::shift_compacted_tiles(exec, first, kept_begins, kept_ends, num_tiles);
+#else
+  return last;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 } // end unique()
 
 
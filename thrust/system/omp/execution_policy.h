@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -139,6 +140,15 @@ struct tag : thrust::system::omp::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  Loops over small ranges are executed by the calling thread, as forking threads would cost more
+ *  than the loop itself. Algorithms built on \p thrust::for_each may instead be given an explicit
+ *  OpenMP loop schedule, which also runs every loop in parallel regardless of its size:
+ *
+ *  \code
+ *  thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_dynamic, 4096),
+ *                   vec.begin(), vec.end(), irregular_functor());
+ *  \endcode
  */
 static const unspecified par;
 
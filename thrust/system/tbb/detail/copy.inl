@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,10 +19,17 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/copy.h>
-#include <thrust/system/detail/generic/copy.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/system/detail/sequential/copy.h>
 #include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/detail/copy.h>
+#include <thrust/detail/seq.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -30,6 +38,79 @@ namespace tbb
 {
 namespace detail
 {
+namespace copy_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename InputIterator,
+         typename OutputIterator,
+         typename Decomposition>
+  struct body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  InputIterator first;
+  OutputIterator result;
+  Decomposition decomp;
+
+  body(InputIterator first, OutputIterator result, Decomposition decomp)
+    : first(first), result(result), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::copy_n(thrust::seq, first + decomp[i].begin(), decomp[i].size(), result + decomp[i].begin());
+    }
+  }
+};
+
+
+// copies every tile of the default decomposition as its own task; the static
+// partitioner runs tile i on thread i of the arena, so the pages of a newly
+// allocated tbb::vector are first touched by, and placed on the NUMA node of,
+// the same thread on every call
+template<typename DerivedPolicy,
+         typename InputIterator,
+         typename Size,
+         typename OutputIterator>
+  OutputIterator copy_n(execution_policy<DerivedPolicy> &exec,
+                        InputIterator first,
+                        Size n,
+                        OutputIterator result)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type          IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+
+  const IndexType signed_n = n;
+
+  if(signed_n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::copy_n(thrust::seq, first, n, result);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(signed_n);
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        body<InputIterator,OutputIterator,Decomposition>(first, result, decomp),
+                        ::tbb::static_partitioner());
+  });
+
+  return result + signed_n;
+} // end copy_n()
+
+
+} // end copy_detail
+
+
 namespace dispatch
 {
 
@@ -56,7 +137,7 @@ template<typename DerivedPolicy,
                       OutputIterator result,
                       thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy(exec, first, last, result);
+  return copy_detail::copy_n(exec, first, thrust::distance(first, last), result);
 } // end copy()
 
 
@@ -84,7 +165,7 @@ template<typename DerivedPolicy,
                         OutputIterator result,
                         thrust::random_access_traversal_tag)
 {
-  return thrust::system::detail::generic::copy_n(exec, first, n, result);
+  return copy_detail::copy_n(exec, first, n, result);
 } // end copy_n()
 
 
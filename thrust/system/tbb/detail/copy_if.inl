@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -19,6 +20,7 @@
 #include <thrust/detail/config.h>
 #include <thrust/detail/function.h>
 #include <thrust/system/tbb/detail/copy_if.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <tbb/blocked_range.h>
@@ -97,11 +99,12 @@ struct body
 
 } // end copy_if_detail
 
-template<typename InputIterator1,
+template<typename DerivedPolicy,
+         typename InputIterator1,
          typename InputIterator2,
          typename OutputIterator,
          typename Predicate>
-  OutputIterator copy_if(tag,
+  OutputIterator copy_if(execution_policy<DerivedPolicy> &exec,
                          InputIterator1 first,
                          InputIterator1 last,
                          InputIterator2 stencil,
@@ -116,7 +119,13 @@ template<typename InputIterator1,
   if (n != 0)
   {
     Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), body);
+    Size grain_size = thrust::system::tbb::detail::grain_size<Size>(exec);
+
+    thrust::system::tbb::detail::execute_in_arena(exec, [&]
+    {
+      thrust::system::tbb::detail::parallel_scan(exec, ::tbb::blocked_range<Size>(0,n,grain_size), body);
+    });
+
     thrust::advance(result, body.sum);
   }
 
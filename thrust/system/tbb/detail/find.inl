@@ -0,0 +1,137 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/find.h>
+#include <thrust/system/tbb/detail/policy_options.h>
+#include <thrust/distance.h>
+#include <thrust/find.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/seq.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+
+#include <atomic>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace find_if_detail
+{
+
+// the number of elements a worker examines between polls of the position found so far
+const int block_size = 1 << 14;
+
+// every worker claims blocks in order from a shared counter, so once a match
+// is found, every block preceding it has already been claimed; the workers
+// which have not started yet may then be cancelled without missing a match
+template<typename InputIterator, typename Predicate, typename Size>
+struct body
+{
+  InputIterator first;
+  thrust::detail::wrapped_function<Predicate,bool> pred;
+  Size n;
+  std::atomic<Size> *next_block;
+  std::atomic<Size> *result;
+  ::tbb::task_group_context *context;
+
+  body(InputIterator first, Predicate pred, Size n, std::atomic<Size> *next_block, std::atomic<Size> *result, ::tbb::task_group_context *context)
+    : first(first), pred(pred), n(n), next_block(next_block), result(result), context(context)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size> &) const
+  {
+    for(;;)
+    {
+      const Size block_begin = next_block->fetch_add(1) * block_size;
+
+      if(block_begin >= result->load())
+      {
+        // every remaining block lies past the end or past a match
+        return;
+      }
+
+      const Size block_end = (thrust::min)(n, block_begin + block_size);
+
+      const Size found = thrust::find_if(thrust::seq, first + block_begin, first + block_end, pred) - first;
+
+      if(found < block_end)
+      {
+        Size found_so_far = result->load();
+
+        while(found < found_so_far && !result->compare_exchange_weak(found_so_far, found))
+        {}
+
+        context->cancel_group_execution();
+
+        return;
+      }
+    }
+  }
+}; // end body
+
+} // end find_if_detail
+
+template <typename DerivedPolicy, typename InputIterator, typename Predicate>
+InputIterator find_if(execution_policy<DerivedPolicy> &exec,
+                      InputIterator first,
+                      InputIterator last,
+                      Predicate pred)
+{
+  typedef typename thrust::iterator_difference<InputIterator>::type Size;
+  typedef find_if_detail::body<InputIterator,Predicate,Size> Body;
+
+  const Size n = thrust::distance(first, last);
+
+  if(n <= find_if_detail::block_size)
+  {
+    return thrust::find_if(thrust::seq, first, last, pred);
+  }
+
+  std::atomic<Size> next_block(0);
+  std::atomic<Size> result(n);
+
+  ::tbb::task_group_context context;
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    // launch one worker per thread of the arena
+    const Size num_workers = thrust::max<Size>(1, ::tbb::this_task_arena::max_concurrency());
+
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_workers, 1),
+                        Body(first, pred, n, &next_block, &result, &context),
+                        ::tbb::simple_partitioner(),
+                        context);
+  });
+
+  return first + result.load();
+} // end find_if()
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2021 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -21,6 +22,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/merge.h>
 #include <thrust/binary_search.h>
 #include <thrust/detail/seq.h>
@@ -228,7 +230,7 @@ template<typename DerivedPolicy,
          typename InputIterator2,
          typename OutputIterator,
          typename StrictWeakOrdering>
-OutputIterator merge(execution_policy<DerivedPolicy> &,
+OutputIterator merge(execution_policy<DerivedPolicy> &exec,
                      InputIterator1 first1,
                      InputIterator1 last1,
                      InputIterator2 first2,
@@ -241,7 +243,10 @@ OutputIterator merge(execution_policy<DerivedPolicy> &,
   Range range(first1, last1, first2, last2, result, comp);
   Body  body;
 
-  ::tbb::parallel_for(range, body);
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(range, body);
+  });
 
   thrust::advance(result, thrust::distance(first1, last1) + thrust::distance(first2, last2));
 
@@ -257,7 +262,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 thrust::pair<OutputIterator1,OutputIterator2>
-  merge_by_key(execution_policy<DerivedPolicy> &,
+  merge_by_key(execution_policy<DerivedPolicy> &exec,
                InputIterator1 keys_first1,
                InputIterator1 keys_last1,
                InputIterator2 keys_first2,
@@ -274,7 +279,10 @@ thrust::pair<OutputIterator1,OutputIterator2>
   Range range(keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
   Body  body;
 
-  ::tbb::parallel_for(range, body);
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(range, body);
+  });
 
   thrust::advance(keys_result,   thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2));
   thrust::advance(values_result, thrust::distance(keys_first1, keys_last1) + thrust::distance(keys_first2, keys_last2));
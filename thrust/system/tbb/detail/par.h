@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2018 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -20,6 +21,8 @@
 #include <thrust/detail/allocator_aware_execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system
 {
@@ -29,12 +32,35 @@ namespace detail
 {
 
 
+// defined in policy_options.h, which includes TBB, along with the members of
+// par_t which return it
+struct execute_with_options;
+
+
 struct par_t : thrust::system::tbb::detail::execution_policy<par_t>,
   thrust::detail::allocator_aware_execution_policy<
     thrust::system::tbb::detail::execution_policy>
 {
   __host__ __device__
   constexpr par_t() : thrust::system::tbb::detail::execution_policy<par_t>() {}
+
+  template<typename TaskArena>
+  __host__
+  execute_with_options on(TaskArena &arena) const;
+
+  __host__
+  inline execute_with_options max_concurrency(int max_concurrency) const;
+
+  __host__
+  inline execute_with_options grain_size(std::size_t grain_size) const;
+
+  template<typename Partitioner>
+  __host__
+  execute_with_options with(Partitioner &partitioner) const;
+
+  template<typename Partitioner>
+  __host__
+  execute_with_options with(const Partitioner &partitioner) const;
 };
 
 
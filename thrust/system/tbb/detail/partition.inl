@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -19,6 +20,14 @@
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/partition.h>
 #include <thrust/system/detail/generic/partition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
+#include <thrust/advance.h>
+#include <thrust/distance.h>
+#include <thrust/pair.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_scan.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -27,6 +36,82 @@ namespace tbb
 {
 namespace detail
 {
+namespace stable_partition_copy_detail
+{
+
+// scans the number of true elements, from which every element's position
+// in either output follows: an element preceded by sum true elements goes to
+// out_true + sum if it is true and to out_false + (i - sum) otherwise
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator1,
+         typename OutputIterator2,
+         typename Predicate,
+         typename Size>
+struct body
+{
+
+  InputIterator1 first;
+  InputIterator2 stencil;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  thrust::detail::wrapped_function<Predicate,bool> pred;
+  Size sum;
+
+  body(InputIterator1 first, InputIterator2 stencil, OutputIterator1 out_true, OutputIterator2 out_false, Predicate pred)
+    : first(first), stencil(stencil), out_true(out_true), out_false(out_false), pred(pred), sum(0)
+  {}
+
+  body(body& b, ::tbb::split)
+    : first(b.first), stencil(b.stencil), out_true(b.out_true), out_false(b.out_false), pred(b.pred), sum(0)
+  {}
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    InputIterator2 iter = stencil + r.begin();
+
+    for (Size i = r.begin(); i != r.end(); ++i, ++iter)
+    {
+      if (pred(*iter))
+        ++sum;
+    }
+  }
+
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    InputIterator1  iter1 = first   + r.begin();
+    InputIterator2  iter2 = stencil + r.begin();
+    OutputIterator1 iter3 = out_true  + sum;
+    OutputIterator2 iter4 = out_false + (r.begin() - sum);
+
+    for (Size i = r.begin(); i != r.end(); ++i, ++iter1, ++iter2)
+    {
+      if (pred(*iter2))
+      {
+        *iter3 = *iter1;
+        ++sum;
+        ++iter3;
+      }
+      else
+      {
+        *iter4 = *iter1;
+        ++iter4;
+      }
+    }
+  }
+
+  void reverse_join(body& b)
+  {
+    sum = b.sum + sum;
+  }
+
+  void assign(body& b)
+  {
+    sum = b.sum;
+  }
+}; // end body
+
+} // end stable_partition_copy_detail
 
 
 template<typename DerivedPolicy,
@@ -69,8 +154,7 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  return thrust::system::tbb::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 
 
@@ -89,8 +173,26 @@ template<typename DerivedPolicy,
                           OutputIterator2 out_false,
                           Predicate pred)
 {
-  // tbb prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  typedef typename thrust::iterator_difference<InputIterator1>::type Size;
+  typedef typename stable_partition_copy_detail::body<InputIterator1,InputIterator2,OutputIterator1,OutputIterator2,Predicate,Size> Body;
+
+  Size n = thrust::distance(first, last);
+
+  if (n != 0)
+  {
+    Body body(first, stencil, out_true, out_false, pred);
+    Size grain_size = thrust::system::tbb::detail::grain_size<Size>(exec);
+
+    thrust::system::tbb::detail::execute_in_arena(exec, [&]
+    {
+      thrust::system::tbb::detail::parallel_scan(exec, ::tbb::blocked_range<Size>(0,n,grain_size), body);
+    });
+
+    thrust::advance(out_true, body.sum);
+    thrust::advance(out_false, n - body.sum);
+  }
+
+  return thrust::make_pair(out_true, out_false);
 } // end stable_partition_copy()
 
 
@@ -0,0 +1,438 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+/*! \file policy_options.h
+ *  \brief The options attached to a TBB execution policy (task arena, concurrency
+ *         limit, grain size, partitioner), and their application to an algorithm.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/execute_with_allocator.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/system/tbb/detail/par.h>
+
+#include <tbb/partitioner.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_scan.h>
+#include <tbb/task_arena.h>
+
+#include <cstddef>
+#include <memory>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+
+
+enum partitioner_kind
+{
+  // each algorithm uses the partitioner it was tuned with
+  partitioner_default,
+  partitioner_auto,
+  partitioner_simple,
+  partitioner_static,
+  partitioner_affinity
+};
+
+
+template<typename Partitioner>
+struct partitioner_kind_of;
+
+
+template<>
+struct partitioner_kind_of< ::tbb::auto_partitioner >
+{
+  static const partitioner_kind value = partitioner_auto;
+};
+
+
+template<>
+struct partitioner_kind_of< ::tbb::simple_partitioner >
+{
+  static const partitioner_kind value = partitioner_simple;
+};
+
+
+template<>
+struct partitioner_kind_of< ::tbb::static_partitioner >
+{
+  static const partitioner_kind value = partitioner_static;
+};
+
+
+template<>
+struct partitioner_kind_of< ::tbb::affinity_partitioner >
+{
+  static const partitioner_kind value = partitioner_affinity;
+};
+
+
+struct options_t
+{
+  options_t()
+    : arena(0),
+      max_concurrency(0),
+      grain_size(0),
+      partitioner(partitioner_default),
+      affinity_state(0)
+  {}
+
+  // the arena to run in, or null to run in the caller's arena
+  ::tbb::task_arena *arena;
+
+  // the number of threads to run with when no arena is given, or 0 for no limit
+  int max_concurrency;
+
+  // the arena limited to max_concurrency threads, created along with the policy and
+  // shared by its copies; TBB only initializes it when an algorithm first runs in it
+  std::shared_ptr< ::tbb::task_arena > limited_arena;
+
+  // the minimum number of elements per task of the loops which split their input
+  // element by element, or 0 for the TBB default
+  std::size_t grain_size;
+
+  // the partitioner of the loops which split their input element by element
+  partitioner_kind partitioner;
+
+  // the affinity_partitioner to use when partitioner is partitioner_affinity
+  ::tbb::affinity_partitioner *affinity_state;
+};
+
+
+// policies without attached options run in the caller's arena with the TBB defaults
+template<typename DerivedPolicy>
+__host__
+const options_t &get_options(const execution_policy<DerivedPolicy> &)
+{
+  static const options_t defaults;
+  return defaults;
+}
+
+
+template<typename Derived>
+struct execute_with_options_base : thrust::system::tbb::detail::execution_policy<Derived>
+{
+private:
+  options_t m_options;
+
+  // lets execute_with_options pass its options on to the policy with an allocator
+  template<typename> friend struct execute_with_options_base;
+
+public:
+  // arena must outlive every algorithm run with the result
+  __host__
+  Derived on(::tbb::task_arena &arena) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.m_options.arena = &arena;
+    return result;
+  }
+
+  // creates the limited arena once; algorithms run with the result, or with its
+  // copies, all run in it
+  __host__
+  Derived max_concurrency(int max_concurrency) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.m_options.max_concurrency = max_concurrency;
+
+    if(max_concurrency > 0)
+    {
+      result.m_options.limited_arena = std::make_shared< ::tbb::task_arena >(max_concurrency);
+    }
+    else
+    {
+      result.m_options.limited_arena.reset();
+    }
+
+    return result;
+  }
+
+  __host__
+  Derived grain_size(std::size_t grain_size) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.m_options.grain_size = grain_size;
+    return result;
+  }
+
+  // an affinity_partitioner records which thread ran each chunk, so it must outlive
+  // every algorithm run with the result, and reusing it across calls over the same
+  // data replays the same chunks on the same threads
+  __host__
+  Derived with(::tbb::affinity_partitioner &partitioner) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    result.m_options.partitioner    = partitioner_affinity;
+    result.m_options.affinity_state = &partitioner;
+    return result;
+  }
+
+  // partitioner is a tbb::auto_partitioner, simple_partitioner or static_partitioner;
+  // the scans only take the auto and simple partitioners, and use auto in place of
+  // a static or affinity partitioner
+  template<typename Partitioner>
+  __host__
+  Derived with(const Partitioner &) const
+  {
+    THRUST_STATIC_ASSERT_MSG(partitioner_kind_of<Partitioner>::value != partitioner_affinity,
+                             "an affinity_partitioner must be passed by non-const reference");
+
+    Derived result = thrust::detail::derived_cast(*this);
+    result.m_options.partitioner = partitioner_kind_of<Partitioner>::value;
+    return result;
+  }
+
+protected:
+  template<typename Policy>
+  __host__
+  Policy with_options_of_this(Policy policy) const
+  {
+    static_cast<execute_with_options_base<Policy>&>(policy).m_options = m_options;
+    return policy;
+  }
+
+private:
+  friend __host__
+  const options_t &get_options(const execute_with_options_base &exec)
+  {
+    return exec.m_options;
+  }
+};
+
+
+// the policy returned by the options of par; like par, it takes an allocator for
+// its temporary storage, e.g. par.on(arena)(alloc), and keeps its options
+struct execute_with_options : execute_with_options_base<execute_with_options>
+{
+  template<typename Allocator>
+  struct execute_with_allocator_type
+  {
+    typedef thrust::detail::execute_with_allocator<Allocator, execute_with_options_base> type;
+  };
+
+  template<typename MemoryResource>
+  __host__
+  typename execute_with_allocator_type<
+    thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>
+  >::type
+    operator()(MemoryResource *mem_res) const
+  {
+    typedef typename execute_with_allocator_type<
+      thrust::mr::allocator<thrust::detail::max_align_t, MemoryResource>
+    >::type result_type;
+
+    return this->with_options_of_this(result_type(mem_res));
+  }
+
+  template<typename Allocator>
+  __host__
+  typename execute_with_allocator_type<Allocator&>::type
+    operator()(Allocator &alloc) const
+  {
+    return this->with_options_of_this(typename execute_with_allocator_type<Allocator&>::type(alloc));
+  }
+
+  template<typename Allocator>
+  __host__
+  typename execute_with_allocator_type<Allocator>::type
+    operator()(const Allocator &alloc) const
+  {
+    return this->with_options_of_this(typename execute_with_allocator_type<Allocator>::type(alloc));
+  }
+};
+
+
+template<typename TaskArena>
+__host__
+execute_with_options par_t::on(TaskArena &arena) const
+{
+  return execute_with_options().on(arena);
+}
+
+
+__host__
+inline execute_with_options par_t::max_concurrency(int max_concurrency) const
+{
+  return execute_with_options().max_concurrency(max_concurrency);
+}
+
+
+__host__
+inline execute_with_options par_t::grain_size(std::size_t grain_size) const
+{
+  return execute_with_options().grain_size(grain_size);
+}
+
+
+template<typename Partitioner>
+__host__
+execute_with_options par_t::with(Partitioner &partitioner) const
+{
+  return execute_with_options().with(partitioner);
+}
+
+
+template<typename Partitioner>
+__host__
+execute_with_options par_t::with(const Partitioner &partitioner) const
+{
+  return execute_with_options().with(partitioner);
+}
+
+
+// runs f in the arena selected by exec and returns its result
+template<typename DerivedPolicy, typename Function>
+auto execute_in_arena(execution_policy<DerivedPolicy> &exec, Function f)
+  -> decltype(f())
+{
+  const options_t &options = get_options(thrust::detail::derived_cast(exec));
+
+  if(options.arena)
+  {
+    return options.arena->execute(f);
+  }
+
+  // an algorithm called from within a limited arena is already limited,
+  // so only enter the policy's arena if the current one allows more threads
+  if(options.limited_arena &&
+     ::tbb::this_task_arena::max_concurrency() > options.max_concurrency)
+  {
+    return options.limited_arena->execute(f);
+  }
+
+  return f();
+}
+
+
+// returns the grain size of the loops over individual elements
+template<typename Size, typename DerivedPolicy>
+Size grain_size(execution_policy<DerivedPolicy> &exec)
+{
+  const options_t &options = get_options(thrust::detail::derived_cast(exec));
+
+  return options.grain_size > 0 ? static_cast<Size>(options.grain_size) : Size(1);
+}
+
+
+// returns the partitioner selected by exec, or default_kind if exec does not select one
+template<typename DerivedPolicy>
+partitioner_kind select_partitioner(execution_policy<DerivedPolicy> &exec,
+                                    partitioner_kind default_kind)
+{
+  const options_t &options = get_options(thrust::detail::derived_cast(exec));
+
+  return options.partitioner != partitioner_default ? options.partitioner : default_kind;
+}
+
+
+template<typename DerivedPolicy>
+::tbb::affinity_partitioner &affinity_state(execution_policy<DerivedPolicy> &exec)
+{
+  return *get_options(thrust::detail::derived_cast(exec)).affinity_state;
+}
+
+
+// ::tbb::parallel_for with the partitioner selected by exec
+template<typename DerivedPolicy, typename Range, typename Body>
+void parallel_for(execution_policy<DerivedPolicy> &exec,
+                  const Range &range,
+                  const Body &body,
+                  partitioner_kind default_kind = partitioner_auto)
+{
+  switch(select_partitioner(exec, default_kind))
+  {
+    case partitioner_simple:
+      ::tbb::parallel_for(range, body, ::tbb::simple_partitioner());
+      break;
+
+    case partitioner_static:
+      ::tbb::parallel_for(range, body, ::tbb::static_partitioner());
+      break;
+
+    case partitioner_affinity:
+      ::tbb::parallel_for(range, body, affinity_state(exec));
+      break;
+
+    default:
+      ::tbb::parallel_for(range, body, ::tbb::auto_partitioner());
+      break;
+  }
+}
+
+
+// ::tbb::parallel_reduce with the partitioner selected by exec
+template<typename DerivedPolicy, typename Range, typename Body>
+void parallel_reduce(execution_policy<DerivedPolicy> &exec,
+                     const Range &range,
+                     Body &body,
+                     partitioner_kind default_kind = partitioner_auto)
+{
+  switch(select_partitioner(exec, default_kind))
+  {
+    case partitioner_simple:
+      ::tbb::parallel_reduce(range, body, ::tbb::simple_partitioner());
+      break;
+
+    case partitioner_static:
+      ::tbb::parallel_reduce(range, body, ::tbb::static_partitioner());
+      break;
+
+    case partitioner_affinity:
+      ::tbb::parallel_reduce(range, body, affinity_state(exec));
+      break;
+
+    default:
+      ::tbb::parallel_reduce(range, body, ::tbb::auto_partitioner());
+      break;
+  }
+}
+
+
+// ::tbb::parallel_scan with the partitioner selected by exec; parallel_scan
+// only accepts the simple and auto partitioners, so the others fall back to auto
+template<typename DerivedPolicy, typename Range, typename Body>
+void parallel_scan(execution_policy<DerivedPolicy> &exec,
+                   const Range &range,
+                   Body &body,
+                   partitioner_kind default_kind = partitioner_auto)
+{
+  if(select_partitioner(exec, default_kind) == partitioner_simple)
+  {
+    ::tbb::parallel_scan(range, body, ::tbb::simple_partitioner());
+  }
+  else
+  {
+    ::tbb::parallel_scan(range, body, ::tbb::auto_partitioner());
+  }
+}
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -23,6 +24,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/distance.h>
 #include <thrust/reduce.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_reduce.h>
 
@@ -99,7 +101,7 @@ template<typename DerivedPolicy,
          typename InputIterator, 
          typename OutputType,
          typename BinaryFunction>
-  OutputType reduce(execution_policy<DerivedPolicy> &,
+  OutputType reduce(execution_policy<DerivedPolicy> &exec,
                     InputIterator begin,
                     InputIterator end,
                     OutputType init,
@@ -117,7 +119,13 @@ template<typename DerivedPolicy,
   {
     typedef typename reduce_detail::body<InputIterator,OutputType,BinaryFunction> Body;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0,n), reduce_body);
+    Size grain_size = thrust::system::tbb::detail::grain_size<Size>(exec);
+
+    thrust::system::tbb::detail::execute_in_arena(exec, [&]
+    {
+      thrust::system::tbb::detail::parallel_reduce(exec, ::tbb::blocked_range<Size>(0,n,grain_size), reduce_body);
+    });
+
     return binary_op(init, reduce_body.sum);
   }
 }
@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -22,6 +23,7 @@
 #include <thrust/detail/seq.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/detail/minmax.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/detail/range/tail_flags.h>
@@ -193,53 +195,53 @@ template<typename Iterator1, typename Iterator2, typename Iterator3, typename It
 
   void operator()(const ::tbb::blocked_range<size_type> &r) const
   {
-    assert(r.size() == 1);
-
-    const size_type interval_idx = r.begin();
-
-    const size_type offset_to_first = interval_size * interval_idx;
-    const size_type offset_to_last = (thrust::min)(n, offset_to_first + interval_size);
-
-    Iterator1 my_keys_first     = keys_first    + offset_to_first;
-    Iterator1 my_keys_last      = keys_first    + offset_to_last;
-    Iterator2 my_values_first   = values_first  + offset_to_first;
-    Iterator3 my_result_offset  = result_offset + interval_idx;
-    Iterator4 my_keys_result    = keys_result   + *my_result_offset;
-    Iterator5 my_values_result  = values_result + *my_result_offset;
-    Iterator6 my_carry_result   = carry_result  + interval_idx;
-
-    // consume the rest of the interval with reduce_by_key
-    typedef typename thrust::iterator_value<Iterator1>::type key_type;
-    typedef typename partial_sum_type<Iterator2,BinaryFunction>::type value_type;
-
-    // XXX is there a way to pose this so that we don't require default construction of carry?
-    thrust::pair<key_type, value_type> carry;
-
-    thrust::tie(my_keys_result, my_values_result, carry.first, carry.second) =
-      reduce_by_key_with_carry(my_keys_first,
-                               my_keys_last,
-                               my_values_first,
-                               my_keys_result,
-                               my_values_result,
-                               binary_pred,
-                               binary_op);
-
-    // store to carry only when we actually have a carry
-    // store to my_keys_result & my_values_result otherwise
-
-    // create tail_flags so we can check for a carry
-    thrust::detail::tail_flags<Iterator1,BinaryPredicate> flags = thrust::detail::make_tail_flags(keys_first, keys_first + n, binary_pred);
-
-    if(interval_has_carry(interval_idx, interval_size, num_intervals, flags.begin()))
-    {
-      // we can ignore the carry's key
-      // XXX because the carry result is uninitialized, we should copy construct
-      *my_carry_result = carry.second;
-    }
-    else
+    // the partitioner selected by the policy may hand a task more than one interval
+    for(size_type interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
     {
-      *my_keys_result = carry.first;
-      *my_values_result = carry.second;
+      const size_type offset_to_first = interval_size * interval_idx;
+      const size_type offset_to_last = (thrust::min)(n, offset_to_first + interval_size);
+
+      Iterator1 my_keys_first     = keys_first    + offset_to_first;
+      Iterator1 my_keys_last      = keys_first    + offset_to_last;
+      Iterator2 my_values_first   = values_first  + offset_to_first;
+      Iterator3 my_result_offset  = result_offset + interval_idx;
+      Iterator4 my_keys_result    = keys_result   + *my_result_offset;
+      Iterator5 my_values_result  = values_result + *my_result_offset;
+      Iterator6 my_carry_result   = carry_result  + interval_idx;
+
+      // consume the rest of the interval with reduce_by_key
+      typedef typename thrust::iterator_value<Iterator1>::type key_type;
+      typedef typename partial_sum_type<Iterator2,BinaryFunction>::type value_type;
+
+      // XXX is there a way to pose this so that we don't require default construction of carry?
+      thrust::pair<key_type, value_type> carry;
+
+      thrust::tie(my_keys_result, my_values_result, carry.first, carry.second) =
+        reduce_by_key_with_carry(my_keys_first,
+                                 my_keys_last,
+                                 my_values_first,
+                                 my_keys_result,
+                                 my_values_result,
+                                 binary_pred,
+                                 binary_op);
+
+      // store to carry only when we actually have a carry
+      // store to my_keys_result & my_values_result otherwise
+
+      // create tail_flags so we can check for a carry
+      thrust::detail::tail_flags<Iterator1,BinaryPredicate> flags = thrust::detail::make_tail_flags(keys_first, keys_first + n, binary_pred);
+
+      if(interval_has_carry(interval_idx, interval_size, num_intervals, flags.begin()))
+      {
+        // we can ignore the carry's key
+        // XXX because the carry result is uninitialized, we should copy construct
+        *my_carry_result = carry.second;
+      }
+      else
+      {
+        *my_keys_result = carry.first;
+        *my_values_result = carry.second;
+      }
     }
   }
 };
@@ -253,9 +255,6 @@ template<typename Iterator1, typename Iterator2, typename Iterator3, typename It
 }
 
 
-} // end reduce_by_key_detail
-
-
 template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typename Iterator3, typename Iterator4, typename BinaryPredicate, typename BinaryFunction>
   thrust::pair<Iterator3,Iterator4>
     reduce_by_key(thrust::tbb::execution_policy<DerivedPolicy> &exec,
@@ -308,10 +307,11 @@ template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typenam
   typedef typename reduce_by_key_detail::partial_sum_type<Iterator2,BinaryFunction>::type carry_type;
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
-  // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(::tbb::blocked_range<difference_type>(0, num_intervals, 1),
+  // force grainsize == 1 with simple_partioner(), unless exec selects another partitioner
+  thrust::system::tbb::detail::parallel_for(exec,
+    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
     reduce_by_key_detail::make_serial_reduce_by_key_body(keys_first, values_first, interval_output_offsets.begin(), keys_result, values_result, carries.begin(), n, interval_size, num_intervals, binary_pred, binary_op),
-    ::tbb::simple_partitioner());
+    partitioner_simple);
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
@@ -334,6 +334,26 @@ template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typenam
 }
 
 
+} // end reduce_by_key_detail
+
+
+template<typename DerivedPolicy, typename Iterator1, typename Iterator2, typename Iterator3, typename Iterator4, typename BinaryPredicate, typename BinaryFunction>
+  thrust::pair<Iterator3,Iterator4>
+    reduce_by_key(thrust::tbb::execution_policy<DerivedPolicy> &exec,
+                  Iterator1 keys_first, Iterator1 keys_last,
+                  Iterator2 values_first,
+                  Iterator3 keys_result,
+                  Iterator4 values_result,
+                  BinaryPredicate binary_pred,
+                  BinaryFunction binary_op)
+{
+  return thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    return reduce_by_key_detail::reduce_by_key(exec, keys_first, keys_last, values_first, keys_result, values_result, binary_pred, binary_op);
+  });
+}
+
+
 } // end detail
 } // end tbb
 } // end system
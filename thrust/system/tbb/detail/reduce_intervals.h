@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,6 +19,7 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/detail/seq.h>
 
 #include <tbb/parallel_for.h>
@@ -59,20 +61,20 @@ template<typename RandomAccessIterator1, typename RandomAccessIterator2, typenam
 
   void operator()(const ::tbb::blocked_range<Size> &r) const
   {
-    assert(r.size() == 1);
-
-    Size interval_idx = r.begin();
-
-    Size offset_to_first = interval_size * interval_idx;
-    Size offset_to_last = (thrust::min)(n, offset_to_first + interval_size);
-
-    RandomAccessIterator1 my_first = first + offset_to_first;
-    RandomAccessIterator1 my_last  = first + offset_to_last;
-
-    // carefully pass the init value for the interval with raw_reference_cast
-    typedef typename BinaryFunction::result_type sum_type;
-    result[interval_idx] =
-      thrust::reduce(thrust::seq, my_first + 1, my_last, sum_type(thrust::raw_reference_cast(*my_first)), binary_op);
+    // the partitioner selected by the policy may hand a task more than one interval
+    for(Size interval_idx = r.begin(); interval_idx != r.end(); ++interval_idx)
+    {
+      Size offset_to_first = interval_size * interval_idx;
+      Size offset_to_last = (thrust::min)(n, offset_to_first + interval_size);
+
+      RandomAccessIterator1 my_first = first + offset_to_first;
+      RandomAccessIterator1 my_last  = first + offset_to_last;
+
+      // carefully pass the init value for the interval with raw_reference_cast
+      typedef typename BinaryFunction::result_type sum_type;
+      result[interval_idx] =
+        thrust::reduce(thrust::seq, my_first + 1, my_last, sum_type(thrust::raw_reference_cast(*my_first)), binary_op);
+    }
   }
 };
 
@@ -89,7 +91,7 @@ template<typename RandomAccessIterator1, typename RandomAccessIterator2, typenam
 
 
 template<typename DerivedPolicy, typename RandomAccessIterator1, typename Size, typename RandomAccessIterator2, typename BinaryFunction>
-  void reduce_intervals(thrust::tbb::execution_policy<DerivedPolicy> &,
+  void reduce_intervals(thrust::tbb::execution_policy<DerivedPolicy> &exec,
                         RandomAccessIterator1 first,
                         RandomAccessIterator1 last,
                         Size interval_size,
@@ -100,7 +102,11 @@ template<typename DerivedPolicy, typename RandomAccessIterator1, typename Size,
 
   Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
 
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1), reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op), ::tbb::simple_partitioner());
+  // one interval per task unless exec selects another partitioner
+  thrust::system::tbb::detail::parallel_for(exec,
+                                            ::tbb::blocked_range<Size>(0, num_intervals, 1),
+                                            reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
+                                            partitioner_simple);
 }
 
 
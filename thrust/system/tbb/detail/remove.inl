@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,7 +19,22 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/remove.h>
+#include <thrust/system/tbb/detail/copy_if.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/tbb/detail/compact_tiles.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/distance.h>
+#include <thrust/remove.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/internal_functional.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -27,6 +43,69 @@ namespace tbb
 {
 namespace detail
 {
+namespace remove_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename ForwardIterator,
+         typename Decomposition,
+         typename Predicate>
+  struct remove_if_body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  ForwardIterator first;
+  Decomposition decomp;
+  index_type *kept_ends;
+  Predicate pred;
+
+  remove_if_body(ForwardIterator first, Decomposition decomp, index_type *kept_ends, Predicate pred)
+    : first(first), decomp(decomp), kept_ends(kept_ends), pred(pred)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      kept_ends[i] = thrust::remove_if(thrust::seq, first + decomp[i].begin(), first + decomp[i].end(), pred) - first;
+    }
+  }
+};
+
+
+template<typename ForwardIterator,
+         typename InputIterator,
+         typename Decomposition,
+         typename Predicate>
+  struct remove_if_stencil_body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  ForwardIterator first;
+  InputIterator stencil;
+  Decomposition decomp;
+  index_type *kept_ends;
+  Predicate pred;
+
+  remove_if_stencil_body(ForwardIterator first, InputIterator stencil, Decomposition decomp, index_type *kept_ends, Predicate pred)
+    : first(first), stencil(stencil), decomp(decomp), kept_ends(kept_ends), pred(pred)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      kept_ends[i] = thrust::remove_if(thrust::seq, first + decomp[i].begin(), first + decomp[i].end(), stencil + decomp[i].begin(), pred) - first;
+    }
+  }
+};
+
+
+} // end namespace remove_detail
 
 template<typename DerivedPolicy,
          typename ForwardIterator,
@@ -36,8 +115,40 @@ template<typename DerivedPolicy,
                             ForwardIterator last,
                             Predicate pred)
 {
-  // tbb prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  typedef typename thrust::iterator_difference<ForwardIterator>::type         IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+  typedef thrust::detail::wrapped_function<Predicate,bool>                   WrappedPredicate;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(n < remove_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::remove_if(thrust::seq, first, last, pred);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  // the range kept by each tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> kept_storage(exec, 2 * decomp.size());
+  IndexType *kept_begins = thrust::raw_pointer_cast(kept_storage.data());
+  IndexType *kept_ends   = kept_begins + decomp.size();
+
+  for(IndexType i = 0; i < decomp.size(); ++i)
+  {
+    kept_begins[i] = decomp[i].begin();
+  }
+
+  // compact every tile to its front
+  typedef remove_detail::remove_if_body<ForwardIterator,Decomposition,WrappedPredicate> Body;
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        Body(first, decomp, kept_ends, WrappedPredicate(pred)),
+                        ::tbb::simple_partitioner());
+  });
+
+  return thrust::system::tbb::detail::shift_compacted_tiles(exec, first, kept_begins, kept_ends, decomp.size());
 }
 
 
@@ -51,8 +162,40 @@ template<typename DerivedPolicy,
                             InputIterator stencil,
                             Predicate pred)
 {
-  // tbb prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  typedef typename thrust::iterator_difference<ForwardIterator>::type         IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+  typedef thrust::detail::wrapped_function<Predicate,bool>                   WrappedPredicate;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(n < remove_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::remove_if(thrust::seq, first, last, stencil, pred);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  // the range kept by each tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> kept_storage(exec, 2 * decomp.size());
+  IndexType *kept_begins = thrust::raw_pointer_cast(kept_storage.data());
+  IndexType *kept_ends   = kept_begins + decomp.size();
+
+  for(IndexType i = 0; i < decomp.size(); ++i)
+  {
+    kept_begins[i] = decomp[i].begin();
+  }
+
+  // compact every tile to its front
+  typedef remove_detail::remove_if_stencil_body<ForwardIterator,InputIterator,Decomposition,WrappedPredicate> Body;
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        Body(first, stencil, decomp, kept_ends, WrappedPredicate(pred)),
+                        ::tbb::simple_partitioner());
+  });
+
+  return thrust::system::tbb::detail::shift_compacted_tiles(exec, first, kept_begins, kept_ends, decomp.size());
 }
 
 
@@ -66,8 +209,8 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // tbb prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
+  // tbb::copy_if needs no stencil-sized scratch, unlike generic::remove_copy_if
+  return thrust::system::tbb::detail::copy_if(exec, first, last, first, result, thrust::detail::not1(pred));
 }
 
 template<typename DerivedPolicy,
@@ -82,8 +225,8 @@ template<typename DerivedPolicy,
                                 OutputIterator result,
                                 Predicate pred)
 {
-  // tbb prefers generic::remove_copy_if to cpp::remove_copy_if
-  return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
+  // tbb::copy_if needs no stencil-sized scratch, unlike generic::remove_copy_if
+  return thrust::system::tbb::detail::copy_if(exec, first, last, stencil, result, thrust::detail::not1(pred));
 }
 
 } // end namespace detail
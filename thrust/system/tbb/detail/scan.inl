@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,8 +19,8 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/scan.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/distance.h>
-#include <thrust/advance.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/detail/function.h>
 #include <thrust/detail/type_traits.h>
@@ -192,10 +193,11 @@ struct exclusive_body
 
 } // end scan_detail
 
-template<typename InputIterator,
+template<typename DerivedPolicy,
+         typename InputIterator,
          typename OutputIterator,
          typename BinaryFunction>
-  OutputIterator inclusive_scan(tag,
+  OutputIterator inclusive_scan(execution_policy<DerivedPolicy> &exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -213,19 +215,23 @@ template<typename InputIterator,
   {
     typedef typename scan_detail::inclusive_body<InputIterator,OutputIterator,BinaryFunction,ValueType> Body;
     Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), scan_body);
-  }
+    Size grain_size = thrust::system::tbb::detail::grain_size<Size>(exec);
 
-  thrust::advance(result, n);
+    thrust::system::tbb::detail::execute_in_arena(exec, [&]
+    {
+      thrust::system::tbb::detail::parallel_scan(exec, ::tbb::blocked_range<Size>(0,n,grain_size), scan_body);
+    });
+  }
 
-  return result;
+  return result + n;
 }
 
-template<typename InputIterator,
+template<typename DerivedPolicy,
+         typename InputIterator,
          typename OutputIterator,
          typename InitialValueType,
          typename BinaryFunction>
-  OutputIterator exclusive_scan(tag,
+  OutputIterator exclusive_scan(execution_policy<DerivedPolicy> &exec,
                                 InputIterator first,
                                 InputIterator last,
                                 OutputIterator result,
@@ -244,12 +250,15 @@ template<typename InputIterator,
   {
     typedef typename scan_detail::exclusive_body<InputIterator,OutputIterator,BinaryFunction,ValueType> Body;
     Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0,n), scan_body);
-  }
+    Size grain_size = thrust::system::tbb::detail::grain_size<Size>(exec);
 
-  thrust::advance(result, n);
+    thrust::system::tbb::detail::execute_in_arena(exec, [&]
+    {
+      thrust::system::tbb::detail::parallel_scan(exec, ::tbb::blocked_range<Size>(0,n,grain_size), scan_body);
+    });
+  }
 
-  return result;
+  return result + n;
 }
 
 } // end namespace detail
@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/scan_by_key.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
+#include <thrust/system/detail/internal/scan_by_key_tiles.h>
+#include <thrust/distance.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace scan_by_key_detail
+{
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Decomposition,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  struct reduce_body
+{
+  typedef typename Decomposition::index_type                                    index_type;
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType>        carry_type;
+
+  InputIterator1 keys;
+  InputIterator2 values;
+  Decomposition decomp;
+  carry_type *carries;
+  const ValueType *head_init;
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  reduce_body(InputIterator1 keys, InputIterator2 values, Decomposition decomp, carry_type *carries, const ValueType *head_init, BinaryPredicate binary_pred, BinaryFunction binary_op)
+    : keys(keys), values(values), decomp(decomp), carries(carries), head_init(head_init), binary_pred(binary_pred), binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      carries[i] = thrust::system::detail::internal::reduce_scan_by_key_tile(
+        keys, values, decomp[i].begin(), decomp[i].end(), head_init, binary_pred, binary_op);
+    }
+  }
+};
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Decomposition,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  struct inclusive_body
+{
+  typedef typename Decomposition::index_type                                    index_type;
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType>        carry_type;
+
+  InputIterator1 keys;
+  InputIterator2 values;
+  OutputIterator result;
+  Decomposition decomp;
+  const carry_type *carries;
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  inclusive_body(InputIterator1 keys, InputIterator2 values, OutputIterator result, Decomposition decomp, const carry_type *carries, BinaryPredicate binary_pred, BinaryFunction binary_op)
+    : keys(keys), values(values), result(result), decomp(decomp), carries(carries), binary_pred(binary_pred), binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::inclusive_scan_by_key_tile(
+        keys, values, result, decomp[i].begin(), decomp[i].end(), carries[i], binary_pred, binary_op);
+    }
+  }
+};
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename Decomposition,
+         typename ValueType,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  struct exclusive_body
+{
+  typedef typename Decomposition::index_type                                    index_type;
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType>        carry_type;
+
+  InputIterator1 keys;
+  InputIterator2 values;
+  OutputIterator result;
+  Decomposition decomp;
+  const carry_type *carries;
+  ValueType init;
+  BinaryPredicate binary_pred;
+  BinaryFunction binary_op;
+
+  exclusive_body(InputIterator1 keys, InputIterator2 values, OutputIterator result, Decomposition decomp, const carry_type *carries, ValueType init, BinaryPredicate binary_pred, BinaryFunction binary_op)
+    : keys(keys), values(values), result(result), decomp(decomp), carries(carries), init(init), binary_pred(binary_pred), binary_op(binary_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::exclusive_scan_by_key_tile(
+        keys, values, result, decomp[i].begin(), decomp[i].end(), carries[i], init, binary_pred, binary_op);
+    }
+  }
+};
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+} // end scan_by_key_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator inclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  typedef typename thrust::iterator_traits<InputIterator2>::value_type   ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type     IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType> carry_type;
+  typedef thrust::detail::wrapped_function<BinaryFunction,ValueType>     WrappedFunction;
+
+  const IndexType n = thrust::distance(first1, last1);
+
+  if(n < scan_by_key_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::inclusive_scan_by_key(thrust::seq, first1, last1, first2, result, binary_pred, binary_op);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  thrust::detail::temporary_array<carry_type,DerivedPolicy> carries_storage(exec, decomp.size());
+  carry_type *carries = thrust::raw_pointer_cast(carries_storage.data());
+
+  WrappedFunction wrapped_binary_op(binary_op);
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    // reduce the last segment of each tile
+    typedef scan_by_key_detail::reduce_body<InputIterator1,InputIterator2,Decomposition,ValueType,BinaryPredicate,WrappedFunction> ReduceBody;
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        ReduceBody(first1, first2, decomp, carries, static_cast<const ValueType*>(0), binary_pred, wrapped_binary_op),
+                        ::tbb::simple_partitioner());
+
+    thrust::system::detail::internal::propagate_scan_by_key_carries(carries, decomp.size(), wrapped_binary_op);
+
+    // rescan every tile, seeded with the sum of the segment which is open on entry to it
+    typedef scan_by_key_detail::inclusive_body<InputIterator1,InputIterator2,OutputIterator,Decomposition,ValueType,BinaryPredicate,WrappedFunction> ScanBody;
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        ScanBody(first1, first2, result, decomp, carries, binary_pred, wrapped_binary_op),
+                        ::tbb::simple_partitioner());
+  });
+
+  return result + n;
+} // end inclusive_scan_by_key()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename T,
+         typename BinaryPredicate,
+         typename BinaryFunction>
+  OutputIterator exclusive_scan_by_key(execution_policy<DerivedPolicy> &exec,
+                                       InputIterator1 first1,
+                                       InputIterator1 last1,
+                                       InputIterator2 first2,
+                                       OutputIterator result,
+                                       T init,
+                                       BinaryPredicate binary_pred,
+                                       BinaryFunction binary_op)
+{
+  typedef T                                                              ValueType;
+  typedef typename thrust::iterator_difference<InputIterator1>::type     IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+  typedef thrust::system::detail::internal::scan_by_key_carry<ValueType> carry_type;
+  typedef thrust::detail::wrapped_function<BinaryFunction,ValueType>     WrappedFunction;
+
+  const IndexType n = thrust::distance(first1, last1);
+
+  if(n < scan_by_key_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::exclusive_scan_by_key(thrust::seq, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  thrust::detail::temporary_array<carry_type,DerivedPolicy> carries_storage(exec, decomp.size());
+  carry_type *carries = thrust::raw_pointer_cast(carries_storage.data());
+
+  WrappedFunction wrapped_binary_op(binary_op);
+
+  const ValueType head_init = init;
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    // reduce the last segment of each tile, seeding every segment with init
+    typedef scan_by_key_detail::reduce_body<InputIterator1,InputIterator2,Decomposition,ValueType,BinaryPredicate,WrappedFunction> ReduceBody;
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        ReduceBody(first1, first2, decomp, carries, &head_init, binary_pred, wrapped_binary_op),
+                        ::tbb::simple_partitioner());
+
+    thrust::system::detail::internal::propagate_scan_by_key_carries(carries, decomp.size(), wrapped_binary_op);
+
+    // rescan every tile, seeded with the sum of the segment which is open on entry to it
+    typedef scan_by_key_detail::exclusive_body<InputIterator1,InputIterator2,OutputIterator,Decomposition,ValueType,BinaryPredicate,WrappedFunction> ScanBody;
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        ScanBody(first1, first2, result, decomp, carries, head_init, binary_pred, wrapped_binary_op),
+                        ::tbb::simple_partitioner());
+  });
+
+  return result + n;
+} // end exclusive_scan_by_key()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
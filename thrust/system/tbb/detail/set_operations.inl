@@ -0,0 +1,319 @@
+/*
+ *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/set_operations.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
+#include <thrust/system/detail/internal/set_operations_partition.h>
+#include <thrust/distance.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace set_operations_detail
+{
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename Decomposition,
+         typename StrictWeakOrdering>
+  struct split_body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  InputIterator1 first1;
+  InputIterator2 first2;
+  index_type n1, n2;
+  Decomposition decomp;
+  index_type *splits1;
+  index_type *splits2;
+  StrictWeakOrdering comp;
+
+  split_body(InputIterator1 first1, InputIterator2 first2, index_type n1, index_type n2, Decomposition decomp, index_type *splits1, index_type *splits2, StrictWeakOrdering comp)
+    : first1(first1), first2(first2), n1(n1), n2(n2), decomp(decomp), splits1(splits1), splits2(splits2), comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::pair<index_type,index_type> split =
+        thrust::system::detail::internal::balanced_path(first1, first2, n1, n2, decomp[i].begin(), comp);
+
+      splits1[i] = split.first;
+      splits2[i] = split.second;
+    }
+  }
+};
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename IndexType,
+         typename StrictWeakOrdering,
+         typename SerialSetOperation>
+  struct count_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  const IndexType *splits1;
+  const IndexType *splits2;
+  IndexType *counts;
+  StrictWeakOrdering comp;
+  SerialSetOperation set_op;
+
+  count_body(InputIterator1 first1, InputIterator2 first2, const IndexType *splits1, const IndexType *splits2, IndexType *counts, StrictWeakOrdering comp, SerialSetOperation set_op)
+    : first1(first1), first2(first2), splits1(splits1), splits2(splits2), counts(counts), comp(comp), set_op(set_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::discard_iterator<> counter;
+
+      counts[i] = set_op(first1 + splits1[i], first1 + splits1[i + 1],
+                         first2 + splits2[i], first2 + splits2[i + 1],
+                         counter,
+                         comp) - counter;
+    }
+  }
+};
+
+
+template<typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename IndexType,
+         typename StrictWeakOrdering,
+         typename SerialSetOperation>
+  struct write_body
+{
+  InputIterator1 first1;
+  InputIterator2 first2;
+  OutputIterator result;
+  const IndexType *splits1;
+  const IndexType *splits2;
+  const IndexType *offsets;
+  StrictWeakOrdering comp;
+  SerialSetOperation set_op;
+
+  write_body(InputIterator1 first1, InputIterator2 first2, OutputIterator result, const IndexType *splits1, const IndexType *splits2, const IndexType *offsets, StrictWeakOrdering comp, SerialSetOperation set_op)
+    : first1(first1), first2(first2), result(result), splits1(splits1), splits2(splits2), offsets(offsets), comp(comp), set_op(set_op)
+  {}
+
+  void operator()(const ::tbb::blocked_range<IndexType> &r) const
+  {
+    for(IndexType i = r.begin(); i != r.end(); ++i)
+    {
+      set_op(first1 + splits1[i], first1 + splits1[i + 1],
+             first2 + splits2[i], first2 + splits2[i + 1],
+             result + offsets[i],
+             comp);
+    }
+  }
+};
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering,
+         typename SerialSetOperation>
+  OutputIterator set_operation(execution_policy<DerivedPolicy> &exec,
+                               InputIterator1 first1,
+                               InputIterator1 last1,
+                               InputIterator2 first2,
+                               InputIterator2 last2,
+                               OutputIterator result,
+                               StrictWeakOrdering comp,
+                               SerialSetOperation set_op)
+{
+  typedef typename thrust::iterator_difference<InputIterator1>::type          IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+  typedef thrust::detail::wrapped_function<StrictWeakOrdering,bool>           WrappedComp;
+
+  const IndexType n1 = thrust::distance(first1, last1);
+  const IndexType n2 = thrust::distance(first2, last2);
+
+  if(n1 + n2 < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // partition the merge of both inputs into one diagonal per thread
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n1 + n2);
+
+  if(decomp.size() <= 1)
+  {
+    return set_op(first1, last1, first2, last2, result, comp);
+  }
+
+  WrappedComp wrapped_comp(comp);
+
+  IndexType num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> storage(exec, 3 * (num_tiles + 1));
+  IndexType *splits1 = thrust::raw_pointer_cast(storage.data());
+  IndexType *splits2 = splits1 + (num_tiles + 1);
+  IndexType *offsets = splits2 + (num_tiles + 1);
+
+  // find where each tile begins in both inputs
+  typedef split_body<InputIterator1,InputIterator2,Decomposition,WrappedComp> SplitBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      SplitBody(first1, first2, n1, n2, decomp, splits1, splits2, wrapped_comp),
+                      ::tbb::simple_partitioner());
+
+  splits1[num_tiles] = n1;
+  splits2[num_tiles] = n2;
+
+  // count the output of each tile
+  typedef count_body<InputIterator1,InputIterator2,IndexType,StrictWeakOrdering,SerialSetOperation> CountBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      CountBody(first1, first2, splits1, splits2, offsets, comp, set_op),
+                      ::tbb::simple_partitioner());
+
+  // scan the counts to find where each tile's output begins
+  offsets[num_tiles] = 0;
+  thrust::exclusive_scan(thrust::seq, offsets, offsets + num_tiles + 1, offsets);
+
+  // write the output of each tile
+  typedef write_body<InputIterator1,InputIterator2,OutputIterator,IndexType,StrictWeakOrdering,SerialSetOperation> WriteBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_tiles, 1),
+                      WriteBody(first1, first2, result, splits1, splits2, offsets, comp, set_op),
+                      ::tbb::simple_partitioner());
+
+  return result + offsets[num_tiles];
+} // end set_operation()
+
+
+} // end namespace set_operations_detail
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_difference(execution_policy<DerivedPolicy> &exec,
+                                InputIterator1 first1,
+                                InputIterator1 last1,
+                                InputIterator2 first2,
+                                InputIterator2 last2,
+                                OutputIterator result,
+                                StrictWeakOrdering comp)
+{
+  return thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                                thrust::system::detail::internal::serial_set_difference());
+  });
+} // end set_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_intersection(execution_policy<DerivedPolicy> &exec,
+                                  InputIterator1 first1,
+                                  InputIterator1 last1,
+                                  InputIterator2 first2,
+                                  InputIterator2 last2,
+                                  OutputIterator result,
+                                  StrictWeakOrdering comp)
+{
+  return thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                                thrust::system::detail::internal::serial_set_intersection());
+  });
+} // end set_intersection()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_symmetric_difference(execution_policy<DerivedPolicy> &exec,
+                                          InputIterator1 first1,
+                                          InputIterator1 last1,
+                                          InputIterator2 first2,
+                                          InputIterator2 last2,
+                                          OutputIterator result,
+                                          StrictWeakOrdering comp)
+{
+  return thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                                thrust::system::detail::internal::serial_set_symmetric_difference());
+  });
+} // end set_symmetric_difference()
+
+
+template<typename DerivedPolicy,
+         typename InputIterator1,
+         typename InputIterator2,
+         typename OutputIterator,
+         typename StrictWeakOrdering>
+  OutputIterator set_union(execution_policy<DerivedPolicy> &exec,
+                           InputIterator1 first1,
+                           InputIterator1 last1,
+                           InputIterator2 first2,
+                           InputIterator2 last2,
+                           OutputIterator result,
+                           StrictWeakOrdering comp)
+{
+  return thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    return set_operations_detail::set_operation(exec, first1, last1, first2, last2, result, comp,
+                                                thrust::system::detail::internal::serial_set_union());
+  });
+} // end set_union()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
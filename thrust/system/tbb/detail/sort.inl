@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -24,6 +25,18 @@
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/detail/seq.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/detail/minmax.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
+#include <thrust/system/detail/internal/radix_sort_tiles.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -221,6 +234,1003 @@ void merge_sort_by_key(execution_policy<DerivedPolicy> &exec,
 } // end namespace sort_detail
 
 
+namespace sample_sort_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const static int threshold = 1024 * 1024;
+
+// the number of samples drawn per bucket
+const static int oversampling = 16;
+
+// bucket indices are stored in one byte per element
+const static unsigned int max_num_buckets = 256;
+
+
+// the positions of the samples: one in the middle of each of num_samples equal intervals
+template<typename IndexType>
+  struct sample_position
+{
+  IndexType n;
+  IndexType num_samples;
+
+  sample_position(IndexType n, IndexType num_samples)
+    : n(n), num_samples(num_samples)
+  {}
+
+  IndexType operator()(IndexType i) const
+  {
+    const IndexType interval = n / num_samples;
+
+    return i * interval + interval / 2;
+  }
+};
+
+
+// stores the sorted splitters[0, num_buckets - 1) as an implicit binary search
+// tree, tree[1] being the root and tree[2 * j], tree[2 * j + 1] the children of tree[j]
+template<typename KeyType>
+void build_splitter_tree(KeyType *tree, const KeyType *splitters, unsigned int j, unsigned int begin, unsigned int end)
+{
+  const unsigned int mid = begin + (end - begin) / 2;
+
+  tree[j] = splitters[mid];
+
+  if(begin < mid)
+  {
+    build_splitter_tree(tree, splitters, 2 * j, begin, mid);
+    build_splitter_tree(tree, splitters, 2 * j + 1, mid + 1, end);
+  }
+}
+
+
+// descends the splitter tree without branching on the comparisons; a key
+// equal to a splitter goes to the bucket following it
+template<typename Reference, typename KeyType, typename StrictWeakOrdering>
+unsigned int classify(const Reference &key, const KeyType *tree, unsigned int log_num_buckets, StrictWeakOrdering comp)
+{
+  unsigned int j = 1;
+
+  for(unsigned int level = 0; level < log_num_buckets; ++level)
+  {
+    j = 2 * j + !comp(key, tree[j]);
+  }
+
+  return j - (1u << log_num_buckets);
+}
+
+
+template<typename RandomAccessIterator,
+         typename Decomposition,
+         typename StrictWeakOrdering>
+  struct classify_body
+{
+  typedef typename Decomposition::index_type                          index_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
+
+  RandomAccessIterator keys;
+  Decomposition decomp;
+  const key_type *tree;
+  unsigned int log_num_buckets;
+  unsigned char *buckets;
+  index_type *counts;
+  StrictWeakOrdering comp;
+
+  classify_body(RandomAccessIterator keys, Decomposition decomp, const key_type *tree, unsigned int log_num_buckets, unsigned char *buckets, index_type *counts, StrictWeakOrdering comp)
+    : keys(keys), decomp(decomp), tree(tree), log_num_buckets(log_num_buckets), buckets(buckets), counts(counts), comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    const unsigned int num_buckets = 1u << log_num_buckets;
+
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      index_type *tile_counts = counts + i * num_buckets;
+
+      for(unsigned int bucket = 0; bucket < num_buckets; ++bucket)
+      {
+        tile_counts[bucket] = 0;
+      }
+
+      for(index_type k = decomp[i].begin(); k != decomp[i].end(); ++k)
+      {
+        unsigned int bucket = classify(keys[k], tree, log_num_buckets, comp);
+
+        buckets[k] = static_cast<unsigned char>(bucket);
+        ++tile_counts[bucket];
+      }
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition>
+  struct scatter_body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  RandomAccessIterator1 keys;
+  RandomAccessIterator2 keys_result;
+  Decomposition decomp;
+  unsigned int num_buckets;
+  const unsigned char *buckets;
+  const index_type *offsets;
+
+  scatter_body(RandomAccessIterator1 keys, RandomAccessIterator2 keys_result, Decomposition decomp, unsigned int num_buckets, const unsigned char *buckets, const index_type *offsets)
+    : keys(keys), keys_result(keys_result), decomp(decomp), num_buckets(num_buckets), buckets(buckets), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      index_type positions[max_num_buckets];
+
+      thrust::copy(thrust::seq, offsets + i * num_buckets, offsets + (i + 1) * num_buckets, positions);
+
+      for(index_type k = decomp[i].begin(); k != decomp[i].end(); ++k)
+      {
+        keys_result[positions[buckets[k]]++] = keys[k];
+      }
+    }
+  }
+};
+
+
+template<typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition>
+  struct scatter_by_key_body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  RandomAccessIterator1 keys;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 keys_result;
+  RandomAccessIterator4 values_result;
+  Decomposition decomp;
+  unsigned int num_buckets;
+  const unsigned char *buckets;
+  const index_type *offsets;
+
+  scatter_by_key_body(RandomAccessIterator1 keys, RandomAccessIterator2 values, RandomAccessIterator3 keys_result, RandomAccessIterator4 values_result, Decomposition decomp, unsigned int num_buckets, const unsigned char *buckets, const index_type *offsets)
+    : keys(keys), values(values), keys_result(keys_result), values_result(values_result), decomp(decomp), num_buckets(num_buckets), buckets(buckets), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      index_type positions[max_num_buckets];
+
+      thrust::copy(thrust::seq, offsets + i * num_buckets, offsets + (i + 1) * num_buckets, positions);
+
+      for(index_type k = decomp[i].begin(); k != decomp[i].end(); ++k)
+      {
+        index_type position = positions[buckets[k]]++;
+
+        keys_result[position]   = keys[k];
+        values_result[position] = values[k];
+      }
+    }
+  }
+};
+
+
+// sorts every bucket of the buffer into its place in the input, which serves as the scratch space
+template<typename DerivedPolicy,
+         typename Iterator1,
+         typename Iterator2,
+         typename StrictWeakOrdering>
+  struct bucket_sort_body
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type index_type;
+
+  execution_policy<DerivedPolicy> &exec;
+  Iterator1 buffer;
+  Iterator2 result;
+  const index_type *bucket_offsets;
+  StrictWeakOrdering comp;
+
+  bucket_sort_body(execution_policy<DerivedPolicy> &exec, Iterator1 buffer, Iterator2 result, const index_type *bucket_offsets, StrictWeakOrdering comp)
+    : exec(exec), buffer(buffer), result(result), bucket_offsets(bucket_offsets), comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type bucket = r.begin(); bucket != r.end(); ++bucket)
+    {
+      sort_detail::merge_sort(exec,
+                              buffer + bucket_offsets[bucket],
+                              buffer + bucket_offsets[bucket + 1],
+                              result + bucket_offsets[bucket],
+                              comp,
+                              false);
+    }
+  }
+};
+
+
+template<typename DerivedPolicy,
+         typename Iterator1,
+         typename Iterator2,
+         typename Iterator3,
+         typename Iterator4,
+         typename StrictWeakOrdering>
+  struct bucket_sort_by_key_body
+{
+  typedef typename thrust::iterator_difference<Iterator1>::type index_type;
+
+  execution_policy<DerivedPolicy> &exec;
+  Iterator1 keys_buffer;
+  Iterator2 values_buffer;
+  Iterator3 keys_result;
+  Iterator4 values_result;
+  const index_type *bucket_offsets;
+  StrictWeakOrdering comp;
+
+  bucket_sort_by_key_body(execution_policy<DerivedPolicy> &exec, Iterator1 keys_buffer, Iterator2 values_buffer, Iterator3 keys_result, Iterator4 values_result, const index_type *bucket_offsets, StrictWeakOrdering comp)
+    : exec(exec), keys_buffer(keys_buffer), values_buffer(values_buffer), keys_result(keys_result), values_result(values_result), bucket_offsets(bucket_offsets), comp(comp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type bucket = r.begin(); bucket != r.end(); ++bucket)
+    {
+      sort_by_key_detail::merge_sort_by_key(exec,
+                                            keys_buffer   + bucket_offsets[bucket],
+                                            keys_buffer   + bucket_offsets[bucket + 1],
+                                            values_buffer + bucket_offsets[bucket],
+                                            keys_result   + bucket_offsets[bucket],
+                                            values_result + bucket_offsets[bucket],
+                                            comp,
+                                            false);
+    }
+  }
+};
+
+
+// chooses the number of buckets, a power of two, for p tiles
+inline unsigned int log_num_buckets(unsigned int p)
+{
+  unsigned int log_k = 1;
+
+  while((1u << log_k) < 4 * p && (1u << log_k) < max_num_buckets)
+  {
+    ++log_k;
+  }
+
+  return log_k;
+}
+
+
+// replaces the per-tile counts, stored tile-major, with the output position of
+// every tile's first key in each bucket and records where every bucket begins
+template<typename IndexType>
+void scan_counts(IndexType *counts, IndexType num_tiles, unsigned int num_buckets, IndexType *bucket_offsets)
+{
+  IndexType sum = 0;
+
+  for(unsigned int bucket = 0; bucket < num_buckets; ++bucket)
+  {
+    bucket_offsets[bucket] = sum;
+
+    for(IndexType tile = 0; tile < num_tiles; ++tile)
+    {
+      IndexType count = counts[tile * num_buckets + bucket];
+      counts[tile * num_buckets + bucket] = sum;
+      sum += count;
+    }
+  }
+
+  bucket_offsets[num_buckets] = sum;
+}
+
+
+// draws samples of [first, first + n), sorts them and builds the splitter tree;
+// returns false if the splitters are all equivalent, in which case a single key
+// makes up nearly all of the samples
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename KeyType,
+         typename StrictWeakOrdering>
+bool choose_splitters(execution_policy<DerivedPolicy> &exec,
+                      RandomAccessIterator first,
+                      typename thrust::iterator_difference<RandomAccessIterator>::type n,
+                      unsigned int num_buckets,
+                      thrust::detail::temporary_array<KeyType,DerivedPolicy> &tree,
+                      StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  const IndexType num_samples = num_buckets * oversampling;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> samples(exec,
+    thrust::make_permutation_iterator(first,
+      thrust::make_transform_iterator(thrust::counting_iterator<IndexType>(0), sample_position<IndexType>(n, num_samples))),
+    num_samples);
+
+  KeyType *s = thrust::raw_pointer_cast(samples.data());
+
+  thrust::stable_sort(thrust::seq, s, s + num_samples, comp);
+
+  // the splitters are every oversampling-th sample
+  for(unsigned int i = 0; i + 1 < num_buckets; ++i)
+  {
+    s[i] = s[(i + 1) * oversampling];
+  }
+
+  build_splitter_tree(thrust::raw_pointer_cast(tree.data()), s, 1, 0, num_buckets - 1);
+
+  return comp(s[0], s[num_buckets - 2]);
+}
+
+
+// sorts [first, last) with the recursive merge sort, which only writes its
+// scratch space before reading it
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void merge_sort_in_place(execution_policy<DerivedPolicy> &exec,
+                         RandomAccessIterator first,
+                         RandomAccessIterator last,
+                         StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> temp(exec, thrust::distance(first, last));
+
+  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void merge_sort_by_key_in_place(execution_policy<DerivedPolicy> &exec,
+                                RandomAccessIterator1 keys_first,
+                                RandomAccessIterator1 keys_last,
+                                RandomAccessIterator2 values_first,
+                                StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+
+  const typename thrust::iterator_difference<RandomAccessIterator1>::type n = thrust::distance(keys_first, keys_last);
+
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   temp1(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> temp2(exec, n);
+
+  sort_by_key_detail::merge_sort_by_key(exec, keys_first, keys_last, values_first, temp1.begin(), temp2.begin(), comp, true);
+}
+
+
+// sorts [first, last) by scattering the keys to buckets delimited by sampled
+// splitters and sorting every bucket independently; the keys are scattered in
+// order and every bucket is sorted stably, so equivalent keys keep their order
+//
+// equivalent keys all land in the same bucket, which the merge sort splits again
+// if it is large; when a single key makes up nearly all of the samples, though,
+// the input is merge sorted directly rather than classified and scattered into
+// what would be essentially one bucket
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void sample_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+
+  const IndexType n = thrust::distance(first, last);
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  if(n < threshold || decomp.size() <= 1)
+  {
+    merge_sort_in_place(exec, first, last, comp);
+
+    return;
+  }
+
+  const unsigned int log_k       = log_num_buckets(decomp.size());
+  const unsigned int num_buckets = 1u << log_k;
+
+  // the splitter tree, whose first element is unused
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> tree(exec, first, num_buckets);
+
+  if(!choose_splitters(exec, first, n, num_buckets, tree, comp))
+  {
+    merge_sort_in_place(exec, first, last, comp);
+
+    return;
+  }
+
+  // classify the keys, counting the keys of every tile in each bucket
+  thrust::detail::temporary_array<unsigned char,DerivedPolicy> buckets_storage(exec, n);
+  unsigned char *buckets = thrust::raw_pointer_cast(buckets_storage.data());
+
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> counts_storage(exec, decomp.size() * num_buckets + num_buckets + 1);
+  IndexType *counts         = thrust::raw_pointer_cast(counts_storage.data());
+  IndexType *bucket_offsets = counts + decomp.size() * num_buckets;
+
+  typedef classify_body<RandomAccessIterator,Decomposition,StrictWeakOrdering> ClassifyBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      ClassifyBody(first, decomp, thrust::raw_pointer_cast(tree.data()), log_k, buckets, counts, comp),
+                      ::tbb::simple_partitioner());
+
+  scan_counts(counts, decomp.size(), num_buckets, bucket_offsets);
+
+  // scatter the keys to their buckets
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> buffer(exec, n);
+
+  typedef scatter_body<RandomAccessIterator,typename thrust::detail::temporary_array<KeyType,DerivedPolicy>::iterator,Decomposition> ScatterBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      ScatterBody(first, buffer.begin(), decomp, num_buckets, buckets, counts),
+                      ::tbb::simple_partitioner());
+
+  // sort every bucket back into the input
+  typedef bucket_sort_body<DerivedPolicy,typename thrust::detail::temporary_array<KeyType,DerivedPolicy>::iterator,RandomAccessIterator,StrictWeakOrdering> BucketSortBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_buckets, 1),
+                      BucketSortBody(exec, buffer.begin(), first, bucket_offsets, comp),
+                      ::tbb::simple_partitioner());
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void sample_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                        RandomAccessIterator1 keys_first,
+                        RandomAccessIterator1 keys_last,
+                        RandomAccessIterator2 values_first,
+                        StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type      ValueType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+
+  const IndexType n = thrust::distance(keys_first, keys_last);
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  if(n < threshold || decomp.size() <= 1)
+  {
+    merge_sort_by_key_in_place(exec, keys_first, keys_last, values_first, comp);
+
+    return;
+  }
+
+  const unsigned int log_k       = log_num_buckets(decomp.size());
+  const unsigned int num_buckets = 1u << log_k;
+
+  // the splitter tree, whose first element is unused
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> tree(exec, keys_first, num_buckets);
+
+  if(!choose_splitters(exec, keys_first, n, num_buckets, tree, comp))
+  {
+    merge_sort_by_key_in_place(exec, keys_first, keys_last, values_first, comp);
+
+    return;
+  }
+
+  // classify the keys, counting the keys of every tile in each bucket
+  thrust::detail::temporary_array<unsigned char,DerivedPolicy> buckets_storage(exec, n);
+  unsigned char *buckets = thrust::raw_pointer_cast(buckets_storage.data());
+
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> counts_storage(exec, decomp.size() * num_buckets + num_buckets + 1);
+  IndexType *counts         = thrust::raw_pointer_cast(counts_storage.data());
+  IndexType *bucket_offsets = counts + decomp.size() * num_buckets;
+
+  typedef classify_body<RandomAccessIterator1,Decomposition,StrictWeakOrdering> ClassifyBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      ClassifyBody(keys_first, decomp, thrust::raw_pointer_cast(tree.data()), log_k, buckets, counts, comp),
+                      ::tbb::simple_partitioner());
+
+  scan_counts(counts, decomp.size(), num_buckets, bucket_offsets);
+
+  // scatter the keys and values to their buckets
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   keys_buffer(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> values_buffer(exec, n);
+
+  typedef typename thrust::detail::temporary_array<KeyType,DerivedPolicy>::iterator   KeysBufferIterator;
+  typedef typename thrust::detail::temporary_array<ValueType,DerivedPolicy>::iterator ValuesBufferIterator;
+
+  typedef scatter_by_key_body<RandomAccessIterator1,RandomAccessIterator2,KeysBufferIterator,ValuesBufferIterator,Decomposition> ScatterBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      ScatterBody(keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), decomp, num_buckets, buckets, counts),
+                      ::tbb::simple_partitioner());
+
+  // sort every bucket back into the input
+  typedef bucket_sort_by_key_body<DerivedPolicy,KeysBufferIterator,ValuesBufferIterator,RandomAccessIterator1,RandomAccessIterator2,StrictWeakOrdering> BucketSortBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, num_buckets, 1),
+                      BucketSortBody(exec, keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, bucket_offsets, comp),
+                      ::tbb::simple_partitioner());
+}
+
+
+} // end namespace sample_sort_detail
+
+
+namespace radix_sort_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const static int threshold = 128 * 1024;
+
+
+template<bool Descending,
+         typename RandomAccessIterator,
+         typename Decomposition>
+  struct count_body
+{
+  typedef typename Decomposition::index_type                          index_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
+
+  RandomAccessIterator keys;
+  Decomposition decomp;
+  thrust::system::detail::internal::radix_pass pass;
+  index_type *counts;
+
+  count_body(RandomAccessIterator keys, Decomposition decomp, thrust::system::detail::internal::radix_pass pass, index_type *counts)
+    : keys(keys), decomp(decomp), pass(pass), counts(counts)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<key_type>::num_buckets;
+
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::radix_count_tile<Descending>(keys, decomp[i].begin(), decomp[i].end(), pass, counts + i * num_buckets);
+    }
+  }
+};
+
+
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition>
+  struct scatter_body
+{
+  typedef typename Decomposition::index_type                           index_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+
+  RandomAccessIterator1 keys;
+  RandomAccessIterator2 keys_result;
+  Decomposition decomp;
+  thrust::system::detail::internal::radix_pass pass;
+  const index_type *offsets;
+
+  scatter_body(RandomAccessIterator1 keys, RandomAccessIterator2 keys_result, Decomposition decomp, thrust::system::detail::internal::radix_pass pass, const index_type *offsets)
+    : keys(keys), keys_result(keys_result), decomp(decomp), pass(pass), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<key_type>::num_buckets;
+
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::radix_scatter_tile<Descending>(keys, decomp[i].begin(), decomp[i].end(), pass, offsets + i * num_buckets, keys_result);
+    }
+  }
+};
+
+
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition>
+  struct scatter_by_key_body
+{
+  typedef typename Decomposition::index_type                           index_type;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+
+  RandomAccessIterator1 keys;
+  RandomAccessIterator2 values;
+  RandomAccessIterator3 keys_result;
+  RandomAccessIterator4 values_result;
+  Decomposition decomp;
+  thrust::system::detail::internal::radix_pass pass;
+  const index_type *offsets;
+
+  scatter_by_key_body(RandomAccessIterator1 keys, RandomAccessIterator2 values, RandomAccessIterator3 keys_result, RandomAccessIterator4 values_result, Decomposition decomp, thrust::system::detail::internal::radix_pass pass, const index_type *offsets)
+    : keys(keys), values(values), keys_result(keys_result), values_result(values_result), decomp(decomp), pass(pass), offsets(offsets)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<key_type>::num_buckets;
+
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::system::detail::internal::radix_scatter_by_key_tile<Descending>(keys, values, decomp[i].begin(), decomp[i].end(), pass, offsets + i * num_buckets, keys_result, values_result);
+    }
+  }
+};
+
+
+// sorts the keys of src by the digit of pass into dst;
+// returns false without writing dst if the pass would not move any key
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition>
+bool radix_sort_pass(RandomAccessIterator1 src,
+                     RandomAccessIterator2 dst,
+                     typename Decomposition::index_type n,
+                     const Decomposition &decomp,
+                     thrust::system::detail::internal::radix_pass pass,
+                     typename Decomposition::index_type *counts)
+{
+  typedef typename Decomposition::index_type                           IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<KeyType>::num_buckets;
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      count_body<Descending,RandomAccessIterator1,Decomposition>(src, decomp, pass, counts),
+                      ::tbb::simple_partitioner());
+
+  if(!thrust::system::detail::internal::radix_scan_counts<num_buckets>(counts, decomp.size(), n))
+  {
+    return false;
+  }
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      scatter_body<Descending,RandomAccessIterator1,RandomAccessIterator2,Decomposition>(src, dst, decomp, pass, counts),
+                      ::tbb::simple_partitioner());
+
+  return true;
+}
+
+
+template<bool Descending,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename RandomAccessIterator3,
+         typename RandomAccessIterator4,
+         typename Decomposition>
+bool radix_sort_by_key_pass(RandomAccessIterator1 keys_src,
+                            RandomAccessIterator2 values_src,
+                            RandomAccessIterator3 keys_dst,
+                            RandomAccessIterator4 values_dst,
+                            typename Decomposition::index_type n,
+                            const Decomposition &decomp,
+                            thrust::system::detail::internal::radix_pass pass,
+                            typename Decomposition::index_type *counts)
+{
+  typedef typename Decomposition::index_type                           IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+
+  const unsigned int num_buckets = thrust::system::detail::internal::radix_sort_traits<KeyType>::num_buckets;
+
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      count_body<Descending,RandomAccessIterator1,Decomposition>(keys_src, decomp, pass, counts),
+                      ::tbb::simple_partitioner());
+
+  if(!thrust::system::detail::internal::radix_scan_counts<num_buckets>(counts, decomp.size(), n))
+  {
+    return false;
+  }
+
+  typedef scatter_by_key_body<Descending,RandomAccessIterator1,RandomAccessIterator2,RandomAccessIterator3,RandomAccessIterator4,Decomposition> ScatterBody;
+  ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                      ScatterBody(keys_src, values_src, keys_dst, values_dst, decomp, pass, counts),
+                      ::tbb::simple_partitioner());
+
+  return true;
+}
+
+
+// sorts [first, first + n) by the bits [begin_bit, end_bit) of its keys
+template<bool Descending,
+         typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename Decomposition>
+void radix_sort_passes(execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator first,
+                       typename Decomposition::index_type n,
+                       const Decomposition &decomp,
+                       unsigned int begin_bit,
+                       unsigned int end_bit)
+{
+  typedef typename Decomposition::index_type                          IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type KeyType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType> traits;
+
+  end_bit = thrust::min<unsigned int>(end_bit, traits::key_bits);
+
+  if(begin_bit >= end_bit)
+  {
+    return;
+  }
+
+  // the passes ping-pong between the input and this buffer
+  thrust::detail::temporary_array<KeyType,DerivedPolicy> buffer(exec, n);
+  KeyType *buf = thrust::raw_pointer_cast(buffer.data());
+
+  // one histogram of digits per tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> counts_storage(exec, decomp.size() * traits::num_buckets);
+  IndexType *counts = thrust::raw_pointer_cast(counts_storage.data());
+
+  bool in_buffer = false;
+
+  for(unsigned int shift = begin_bit; shift < end_bit; shift += traits::radix_bits)
+  {
+    thrust::system::detail::internal::radix_pass pass = thrust::system::detail::internal::make_radix_pass<KeyType>(shift, end_bit);
+
+    bool moved = in_buffer ?
+      radix_sort_pass<Descending>(buf, first, n, decomp, pass, counts) :
+      radix_sort_pass<Descending>(first, buf, n, decomp, pass, counts);
+
+    if(moved)
+    {
+      in_buffer = !in_buffer;
+    }
+  }
+
+  if(in_buffer)
+  {
+    thrust::copy(exec, buf, buf + n, first);
+  }
+}
+
+
+template<bool Descending,
+         typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename Decomposition>
+void radix_sort_by_key_passes(execution_policy<DerivedPolicy> &exec,
+                              RandomAccessIterator1 keys_first,
+                              RandomAccessIterator2 values_first,
+                              typename Decomposition::index_type n,
+                              const Decomposition &decomp,
+                              unsigned int begin_bit,
+                              unsigned int end_bit)
+{
+  typedef typename Decomposition::index_type                           IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type KeyType;
+  typedef typename thrust::iterator_value<RandomAccessIterator2>::type ValueType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType>  traits;
+
+  end_bit = thrust::min<unsigned int>(end_bit, traits::key_bits);
+
+  if(begin_bit >= end_bit)
+  {
+    return;
+  }
+
+  // the passes ping-pong between the input and these buffers
+  thrust::detail::temporary_array<KeyType,DerivedPolicy>   keys_buffer(exec, n);
+  thrust::detail::temporary_array<ValueType,DerivedPolicy> values_buffer(exec, n);
+  KeyType   *keys_buf   = thrust::raw_pointer_cast(keys_buffer.data());
+  ValueType *values_buf = thrust::raw_pointer_cast(values_buffer.data());
+
+  // one histogram of digits per tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> counts_storage(exec, decomp.size() * traits::num_buckets);
+  IndexType *counts = thrust::raw_pointer_cast(counts_storage.data());
+
+  bool in_buffer = false;
+
+  for(unsigned int shift = begin_bit; shift < end_bit; shift += traits::radix_bits)
+  {
+    thrust::system::detail::internal::radix_pass pass = thrust::system::detail::internal::make_radix_pass<KeyType>(shift, end_bit);
+
+    bool moved = in_buffer ?
+      radix_sort_by_key_pass<Descending>(keys_buf, values_buf, keys_first, values_first, n, decomp, pass, counts) :
+      radix_sort_by_key_pass<Descending>(keys_first, values_first, keys_buf, values_buf, n, decomp, pass, counts);
+
+    if(moved)
+    {
+      in_buffer = !in_buffer;
+    }
+  }
+
+  if(in_buffer)
+  {
+    thrust::copy(exec, keys_buf,   keys_buf   + n, keys_first);
+    thrust::copy(exec, values_buf, values_buf + n, values_first);
+  }
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void radix_sort(execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type      KeyType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType>     traits;
+
+  const bool descending = thrust::system::detail::internal::radix_sort_is_descending<KeyType,StrictWeakOrdering>::value;
+
+  const IndexType n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  if(n < threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  radix_sort_passes<descending>(exec, first, n, decomp, 0, traits::key_bits);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+void radix_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator1 keys_first,
+                       RandomAccessIterator1 keys_last,
+                       RandomAccessIterator2 values_first,
+                       StrictWeakOrdering comp)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type      KeyType;
+  typedef thrust::system::detail::internal::radix_sort_traits<KeyType>      traits;
+
+  const bool descending = thrust::system::detail::internal::radix_sort_is_descending<KeyType,StrictWeakOrdering>::value;
+
+  const IndexType n = thrust::distance(keys_first, keys_last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  if(n < threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  radix_sort_by_key_passes<descending>(exec, keys_first, values_first, n, decomp, 0, traits::key_bits);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+void radix_sort(execution_policy<DerivedPolicy> &exec,
+                RandomAccessIterator first,
+                RandomAccessIterator last,
+                unsigned int begin_bit,
+                unsigned int end_bit)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator>::type IndexType;
+
+  const IndexType n = thrust::distance(first, last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  if(n < threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::sort(thrust::seq, first, last, begin_bit, end_bit);
+    return;
+  }
+
+  radix_sort_passes<false>(exec, first, n, decomp, begin_bit, end_bit);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+void radix_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                       RandomAccessIterator1 keys_first,
+                       RandomAccessIterator1 keys_last,
+                       RandomAccessIterator2 values_first,
+                       unsigned int begin_bit,
+                       unsigned int end_bit)
+{
+  typedef typename thrust::iterator_difference<RandomAccessIterator1>::type IndexType;
+
+  const IndexType n = thrust::distance(keys_first, keys_last);
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  if(n < threshold || decomp.size() <= 1)
+  {
+    // don't bother parallelizing for small n
+    thrust::sort_by_key(thrust::seq, keys_first, keys_last, values_first, begin_bit, end_bit);
+    return;
+  }
+
+  radix_sort_by_key_passes<false>(exec, keys_first, values_first, n, decomp, begin_bit, end_bit);
+}
+
+
+} // end namespace radix_sort_detail
+
+
+namespace sort_detail
+{
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::true_type)
+{
+  radix_sort_detail::radix_sort(exec, first, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void stable_sort(execution_policy<DerivedPolicy> &exec,
+                 RandomAccessIterator first,
+                 RandomAccessIterator last,
+                 StrictWeakOrdering comp,
+                 thrust::detail::false_type)
+{
+  sample_sort_detail::sample_sort(exec, first, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 first1,
+                          RandomAccessIterator1 last1,
+                          RandomAccessIterator2 first2,
+                          StrictWeakOrdering comp,
+                          thrust::detail::true_type)
+{
+  radix_sort_detail::radix_sort_by_key(exec, first1, last1, first2, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void stable_sort_by_key(execution_policy<DerivedPolicy> &exec,
+                          RandomAccessIterator1 first1,
+                          RandomAccessIterator1 last1,
+                          RandomAccessIterator2 first2,
+                          StrictWeakOrdering comp,
+                          thrust::detail::false_type)
+{
+  sample_sort_detail::sample_sort_by_key(exec, first1, last1, first2, comp);
+}
+
+
+} // end namespace sort_detail
+
+
 template<typename DerivedPolicy,
          typename RandomAccessIterator,
          typename StrictWeakOrdering>
@@ -231,9 +1241,12 @@ void stable_sort(execution_policy<DerivedPolicy> &exec,
 {
   typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
+  thrust::system::detail::internal::use_radix_sort<key_type,StrictWeakOrdering> use_radix_sort;
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    sort_detail::stable_sort(exec, first, last, comp, use_radix_sort);
+  });
 }
 
 
@@ -248,14 +1261,85 @@ template<typename DerivedPolicy,
                           StrictWeakOrdering comp)
 {
   typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
-  typedef typename thrust::iterator_value<RandomAccessIterator2>::type val_type;
 
-  RandomAccessIterator2 last2 = first2 + thrust::distance(first1, last1);
+  thrust::system::detail::internal::use_radix_sort<key_type,StrictWeakOrdering> use_radix_sort;
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    sort_detail::stable_sort_by_key(exec, first1, last1, first2, comp, use_radix_sort);
+  });
+}
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
-  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+template<typename DerivedPolicy,
+         typename RandomAccessIterator,
+         typename StrictWeakOrdering>
+void sort(execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          StrictWeakOrdering comp)
+{
+  thrust::system::tbb::detail::stable_sort(exec, first, last, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2,
+         typename StrictWeakOrdering>
+  void sort_by_key(execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   StrictWeakOrdering comp)
+{
+  thrust::system::tbb::detail::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator>
+void sort(execution_policy<DerivedPolicy> &exec,
+          RandomAccessIterator first,
+          RandomAccessIterator last,
+          unsigned int begin_bit,
+          unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator>::type key_type;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<key_type>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    radix_sort_detail::radix_sort(exec, first, last, begin_bit, end_bit);
+  });
+}
+
+
+template<typename DerivedPolicy,
+         typename RandomAccessIterator1,
+         typename RandomAccessIterator2>
+  void sort_by_key(execution_policy<DerivedPolicy> &exec,
+                   RandomAccessIterator1 keys_first,
+                   RandomAccessIterator1 keys_last,
+                   RandomAccessIterator2 values_first,
+                   unsigned int begin_bit,
+                   unsigned int end_bit)
+{
+  typedef typename thrust::iterator_value<RandomAccessIterator1>::type key_type;
+
+  THRUST_STATIC_ASSERT_MSG(
+    thrust::detail::is_arithmetic<key_type>::value
+  , "sorting by a range of bits requires arithmetic keys"
+  );
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    radix_sort_detail::radix_sort_by_key(exec, keys_first, keys_last, values_first, begin_bit, end_bit);
+  });
 }
 
 
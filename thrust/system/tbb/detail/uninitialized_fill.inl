@@ -0,0 +1,160 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/system/tbb/detail/uninitialized_fill.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
+#include <thrust/system/detail/generic/uninitialized_fill.h>
+#include <thrust/uninitialized_fill.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/seq.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system
+{
+namespace tbb
+{
+namespace detail
+{
+namespace uninitialized_fill_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x,
+                                       thrust::incrementable_traversal_tag)
+{
+  return thrust::system::detail::generic::uninitialized_fill_n(exec, first, n, x);
+}
+
+
+template<typename ForwardIterator,
+         typename T,
+         typename Decomposition>
+  struct body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  ForwardIterator first;
+  T x;
+  Decomposition decomp;
+
+  body(ForwardIterator first, const T &x, Decomposition decomp)
+    : first(first), x(x), decomp(decomp)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      thrust::uninitialized_fill_n(thrust::seq, first + decomp[i].begin(), decomp[i].size(), x);
+    }
+  }
+};
+
+
+// constructs every tile of the default decomposition as its own task; the static
+// partitioner runs tile i on thread i of the arena, so the pages of a newly allocated
+// tbb::vector are first touched by, and placed on the NUMA node of, the same thread
+// on every call
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x,
+                                       thrust::random_access_traversal_tag)
+{
+  typedef typename thrust::iterator_difference<ForwardIterator>::type        IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+
+  const IndexType signed_n = n;
+
+  if(signed_n < parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::uninitialized_fill_n(thrust::seq, first, n, x);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(signed_n);
+
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        body<ForwardIterator,T,Decomposition>(first, x, decomp),
+                        ::tbb::static_partitioner());
+  });
+
+  return first + signed_n;
+}
+
+
+} // end uninitialized_fill_detail
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename T>
+  void uninitialized_fill(execution_policy<DerivedPolicy> &exec,
+                          ForwardIterator first,
+                          ForwardIterator last,
+                          const T &x)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  uninitialized_fill_detail::uninitialized_fill_n(exec, first, thrust::distance(first, last), x, traversal());
+} // end uninitialized_fill()
+
+
+template<typename DerivedPolicy,
+         typename ForwardIterator,
+         typename Size,
+         typename T>
+  ForwardIterator uninitialized_fill_n(execution_policy<DerivedPolicy> &exec,
+                                       ForwardIterator first,
+                                       Size n,
+                                       const T &x)
+{
+  typedef typename thrust::iterator_traversal<ForwardIterator>::type traversal;
+
+  return uninitialized_fill_detail::uninitialized_fill_n(exec, first, n, x, traversal());
+} // end uninitialized_fill_n()
+
+
+} // end namespace detail
+} // end namespace tbb
+} // end namespace system
+THRUST_NAMESPACE_END
+
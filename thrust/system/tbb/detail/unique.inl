@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -18,8 +19,21 @@
 
 #include <thrust/detail/config.h>
 #include <thrust/system/tbb/detail/unique.h>
+#include <thrust/system/tbb/detail/default_decomposition.h>
+#include <thrust/system/tbb/detail/policy_options.h>
 #include <thrust/system/detail/generic/unique.h>
+#include <thrust/system/tbb/detail/compact_tiles.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/distance.h>
 #include <thrust/pair.h>
+#include <thrust/unique.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system
@@ -28,6 +42,41 @@ namespace tbb
 {
 namespace detail
 {
+namespace unique_detail
+{
+
+
+// XXX this value is a tuning opportunity
+const int parallelism_threshold = 10000;
+
+
+template<typename ForwardIterator,
+         typename Decomposition,
+         typename BinaryPredicate>
+  struct unique_body
+{
+  typedef typename Decomposition::index_type index_type;
+
+  ForwardIterator first;
+  Decomposition decomp;
+  index_type *kept_ends;
+  BinaryPredicate binary_pred;
+
+  unique_body(ForwardIterator first, Decomposition decomp, index_type *kept_ends, BinaryPredicate binary_pred)
+    : first(first), decomp(decomp), kept_ends(kept_ends), binary_pred(binary_pred)
+  {}
+
+  void operator()(const ::tbb::blocked_range<index_type> &r) const
+  {
+    for(index_type i = r.begin(); i != r.end(); ++i)
+    {
+      kept_ends[i] = thrust::unique(thrust::seq, first + decomp[i].begin(), first + decomp[i].end(), binary_pred) - first;
+    }
+  }
+};
+
+
+} // end namespace unique_detail
 
 
 template<typename DerivedPolicy,
@@ -38,8 +87,47 @@ template<typename DerivedPolicy,
                          ForwardIterator last,
                          BinaryPredicate binary_pred)
 {
-  // tbb prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec,first,last,binary_pred);
+  typedef typename thrust::iterator_difference<ForwardIterator>::type         IndexType;
+  typedef thrust::system::detail::internal::uniform_decomposition<IndexType> Decomposition;
+  typedef thrust::detail::wrapped_function<BinaryPredicate,bool>             WrappedPredicate;
+
+  const IndexType n = thrust::distance(first, last);
+
+  if(n < unique_detail::parallelism_threshold)
+  {
+    // don't bother parallelizing for small n
+    return thrust::unique(thrust::seq, first, last, binary_pred);
+  }
+
+  Decomposition decomp = thrust::system::tbb::detail::default_decomposition(n);
+
+  WrappedPredicate wrapped_binary_pred(binary_pred);
+
+  // the range kept by each tile
+  thrust::detail::temporary_array<IndexType,DerivedPolicy> kept_storage(exec, 2 * decomp.size());
+  IndexType *kept_begins = thrust::raw_pointer_cast(kept_storage.data());
+  IndexType *kept_ends   = kept_begins + decomp.size();
+
+  // a tile drops its first element when it continues the run the tile before it ends with;
+  // decide this before any tile is compacted over its last element
+  kept_begins[0] = 0;
+  for(IndexType i = 1; i < decomp.size(); ++i)
+  {
+    const IndexType b = decomp[i].begin();
+
+    kept_begins[i] = wrapped_binary_pred(first[b - 1], first[b]) ? b + 1 : b;
+  }
+
+  // compact every tile to its front
+  typedef unique_detail::unique_body<ForwardIterator,Decomposition,WrappedPredicate> Body;
+  thrust::system::tbb::detail::execute_in_arena(exec, [&]
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<IndexType>(0, decomp.size(), 1),
+                        Body(first, decomp, kept_ends, wrapped_binary_pred),
+                        ::tbb::simple_partitioner());
+  });
+
+  return thrust::system::tbb::detail::shift_compacted_tiles(exec, first, kept_begins, kept_ends, decomp.size());
 } // end unique()
 
 
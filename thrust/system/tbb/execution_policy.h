@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -28,6 +29,9 @@
 // get the definition of par
 #include <thrust/system/tbb/detail/par.h>
 
+// get the definitions of the options of par
+#include <thrust/system/tbb/detail/policy_options.h>
+
 // now get all the algorithm definitions
 
 #include <thrust/system/tbb/detail/adjacent_difference.h>
@@ -139,6 +143,35 @@ struct tag : thrust::system::tbb::execution_policy<tag> { unspecified };
  *
  *  // 0 1 2 is printed to standard output in some unspecified order
  *  \endcode
+ *
+ *  Algorithms run in the calling thread's task arena by default. \p par.on(arena) runs them in
+ *  the given \p tbb::task_arena instead, which must outlive the calls, and \p par.max_concurrency(n)
+ *  runs them with at most \p n threads, in an arena created along with the policy and reused by
+ *  every call with it or its copies. \p par.grain_size(n) sets the minimum number of elements
+ *  per task of \p for_each, \p reduce and the scans. An allocator for the temporary storage is
+ *  given after the options, as in <tt>par.on(arena)(alloc)</tt>:
+ *
+ *  \code
+ *  tbb::task_arena arena(4);
+ *
+ *  thrust::for_each(thrust::tbb::par.on(arena).grain_size(1024),
+ *                   vec.begin(), vec.end(), printf_functor());
+ *  \endcode
+ *
+ *  \p par.with(partitioner) selects the TBB partitioner of those loops and of \p reduce_by_key.
+ *  \p tbb::parallel_scan only takes the auto and simple partitioners, so the scans use
+ *  \p tbb::auto_partitioner in place of a static or affinity partitioner.
+ *  A \p tbb::affinity_partitioner reused across calls over the same data runs every chunk on the
+ *  thread which processed it in the previous call, where it is likely still cached:
+ *
+ *  \code
+ *  tbb::affinity_partitioner affinity;
+ *
+ *  for(int i = 0; i < num_iterations; ++i)
+ *  {
+ *    thrust::transform(thrust::tbb::par.with(affinity), x.begin(), x.end(), y.begin(), step_functor());
+ *  }
+ *  \endcode
  */
 static const unspecified par;
 
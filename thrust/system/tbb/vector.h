@@ -1,5 +1,6 @@
 /*
  *  Copyright 2008-2013 NVIDIA Corporation
+ *  Modifications Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -37,6 +38,11 @@ namespace system { namespace tbb
  *  automatic. The elements contained in a \p tbb::vector reside in memory
  *  accessible by the \p tbb system.
  *
+ *  Construction, resizing and assignment initialize large vectors in parallel,
+ *  one tile per thread, with the same decomposition as the algorithms of the
+ *  \p tbb system, so every page is first touched by, and on NUMA systems placed
+ *  near, the thread which later processes it.
+ *
  *  \tparam T The element type of the \p tbb::vector.
  *  \tparam Allocator The allocator type of the \p tbb::vector.
  *          Defaults to \p tbb::allocator.
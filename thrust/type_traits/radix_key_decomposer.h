@@ -0,0 +1,169 @@
+/*
+ *  Copyright© 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*! \file
+ *  \brief A customization point which lets the host systems radix sort
+ *  keys that are not arithmetic types.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/tuple.h>
+#include <thrust/type_traits/void_t.h>
+
+#include <utility>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup utility
+ *  \{
+ */
+
+/*! \addtogroup type_traits Type Traits
+ *  \{
+ */
+
+/*! \brief Customization point that decomposes a key of type \c Key into a
+ *  \p tuple of arithmetic fields, most significant field first.
+ *
+ *  The sequential sorts of the host systems sort arithmetic keys with a radix
+ *  sort when they are compared with \p less or \p greater, and every other key
+ *  with a merge sort. Specializing \c radix_key_decomposer for \c Key, with a
+ *  \c const call operator taking a <tt>const Key&</tt> and returning a \p tuple
+ *  of arithmetic values, lets them radix sort \c Key as well: the fields are
+ *  sorted one after another, from the last to the first, so the keys end up in
+ *  the lexicographical order of their decompositions. The specialization must
+ *  order keys as <tt>operator<</tt> does.
+ *
+ *  \p tuple of arithmetic types, the value type of a \p zip_iterator over
+ *  arithmetic ranges, decomposes into itself out of the box.
+ *
+ *  The following code snippet demonstrates how to radix sort a \c struct key:
+ *
+ *  \code
+ *  #include <thrust/sort.h>
+ *  #include <thrust/type_traits/radix_key_decomposer.h>
+ *
+ *  struct date
+ *  {
+ *    short year;
+ *    unsigned char month, day;
+ *  };
+ *
+ *  __host__ __device__
+ *  bool operator<(const date &lhs, const date &rhs)
+ *  {
+ *    return thrust::make_tuple(lhs.year, lhs.month, lhs.day) <
+ *           thrust::make_tuple(rhs.year, rhs.month, rhs.day);
+ *  }
+ *
+ *  THRUST_NAMESPACE_BEGIN
+ *  template<>
+ *  struct radix_key_decomposer<date>
+ *  {
+ *    __host__ __device__
+ *    thrust::tuple<short, unsigned char, unsigned char> operator()(const date &d) const
+ *    {
+ *      return thrust::make_tuple(d.year, d.month, d.day);
+ *    }
+ *  };
+ *  THRUST_NAMESPACE_END
+ *  ...
+ *  thrust::sort(thrust::host, dates.begin(), dates.end());
+ *  \endcode
+ *
+ *  \see is_radix_key_decomposable
+ */
+template <typename Key, typename Enable = void>
+struct radix_key_decomposer
+{};
+
+/*! \cond
+ */
+
+namespace detail
+{
+
+template <typename T>
+struct is_radix_key_field
+  : integral_constant<
+      bool
+    , is_arithmetic<T>::value || is_same<T, thrust::null_type>::value
+    >
+{};
+
+} // namespace detail
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+          typename T5, typename T6, typename T7, typename T8, typename T9>
+struct radix_key_decomposer<
+  thrust::tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9>
+, typename detail::enable_if<
+    detail::and_<
+      detail::is_radix_key_field<T0>, detail::is_radix_key_field<T1>
+    , detail::is_radix_key_field<T2>, detail::is_radix_key_field<T3>
+    , detail::is_radix_key_field<T4>, detail::is_radix_key_field<T5>
+    , detail::is_radix_key_field<T6>, detail::is_radix_key_field<T7>
+    , detail::is_radix_key_field<T8>, detail::is_radix_key_field<T9>
+    >::value
+  >::type
+>
+{
+  typedef thrust::tuple<T0, T1, T2, T3, T4, T5, T6, T7, T8, T9> key_type;
+
+  __host__ __device__
+  key_type operator()(const key_type &key) const
+  {
+    return key;
+  }
+};
+
+/*! \endcond
+ */
+
+/*! \brief <a href="https://en.cppreference.com/w/cpp/named_req/UnaryTypeTrait"><i>UnaryTypeTrait</i></a>
+ *  that returns \c true_type if \p radix_key_decomposer is specialized for
+ *  \c Key, and \c false_type otherwise.
+ *
+ * \see radix_key_decomposer
+ */
+template <typename Key, typename Enable = void>
+struct is_radix_key_decomposable : false_type
+{};
+
+/*! \cond
+ */
+
+template <typename Key>
+struct is_radix_key_decomposable<
+  Key
+, void_t<decltype(radix_key_decomposer<Key>()(std::declval<const Key &>()))>
+> : true_type
+{};
+
+/*! \endcond
+ */
+
+/*! \} // type traits
+ */
+
+/*! \} // utility
+ */
+
+THRUST_NAMESPACE_END
+